@@ -3,7 +3,7 @@
 //*																													*
 //*   File:       JAACfg.h																							*
 //*   Suite:      Experimental Algorithms																			*
-//*   Version:    1.0.0	(Build: 01)																					*
+//*   Version:    1.1.0	(Build: 02)																					*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2025 Ian J. Tree																				*
@@ -25,12 +25,13 @@
 //*	CONFIGURATION XML SPECIFICATION																					*
 //*	---------------------------																						*
 //*																													*
-//*		<jaa cycles="n">																							*
+//*		<jaa cycles="n" inmemory="true">																			*
 //*			<images>d</images>																						*
 //*			<baseimage>b</baseimage>																				*
 //*		</jaa>																										*
 //*																													*
 //*			where n is the number of cycles of JPEG encoding to perform												*
+//*			inmemory="true" encodes and decodes each cycle in memory (no intermediate JPEG files)					*
 //*			where d is the (virtual) directory for all images (input & generated).									*
 //*			where b is the name of the base image to use															*
 //*																													*
@@ -38,10 +39,11 @@
 //*	COMMAND LINE SPECIFICATION																						*
 //*	--------------------------																						*
 //*																													*
-//*		JPEGAA <image directory> <base image name> -V -E -C:n														*
+//*		JPEGAA <image directory> <base image name> -V -E -M -C:n													*
 //*																													*
 //*		Where -V or (-v)	==>	Verbose logging enabled																*
 //*		-E or (-e)			==> Echo the log to the console															*
+//*		-M or (-m)			==> Encode and decode each cycle in memory (no intermediate JPEG files)					*
 //*		-C:n or -c:n		==> Perform n cycles of jpeg encoding													*
 //*																													*
 //*******************************************************************************************************************
@@ -49,6 +51,7 @@
 //*   History:																										*
 //*																													*
 //*	1.0.0 -		17/04/2025	-	Initial Release																		*
+//*	1.1.0 -		16/10/2026	-	In-memory encoding cycles																*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -87,6 +90,7 @@ public:
 		: xymorg::AppConfig(szAppName, argc, argv)
 		, ConfigValid(false)
 		, NumCycles(0)
+		, InMemory(false)
 		, RID(NULLSTRREF)
 		, RBI(NULLSTRREF)
 	{
@@ -169,6 +173,21 @@ public:
 
 	int		getCycles() const { return NumCycles; }
 
+	//  isInMemory
+	//
+	//  This function will return the in-memory state of the experiment
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		bool		-		true if each cycle is encoded and decoded in memory, false if it is round-tripped through a file
+	//
+	//	NOTES:
+	//
+
+	bool	isInMemory() const { return InMemory; }
+
 	//  getImgDir
 	//
 	//  This function will return the name of the images directory
@@ -209,6 +228,7 @@ private:
 
 	bool				ConfigValid;												//  Validity state of configuration
 	int					NumCycles;													//  Number of cycles to perform
+	bool				InMemory;													//  Encode and decode cycles in memory
 	xymorg::STRREF		RID;														//  Reference to the images directory name
 	xymorg::STRREF		RBI;														//  Reference to the base image name
 
@@ -308,6 +328,14 @@ private:
 				}
 			}
 
+			//  Test for in-memory cycles
+			if (strlen(argv[SWX]) == 2) {
+				if (_memicmp(argv[SWX], "-M", 2) == 0) {
+					SWValid = true;
+					InMemory = true;
+				}
+			}
+
 			//  Test for number of trials
 			if (strlen(argv[SWX]) > 3) {
 				if (_memicmp(argv[SWX], "-C:", 3) == 0) {
@@ -371,6 +399,7 @@ private:
 		xymorg::XMLMicroParser					CfgXML(pCfgImg);									//  XML Micro Parser for the application configuration file
 		xymorg::XMLMicroParser::XMLIterator		JAANode = CfgXML.getScope("jaa");					//  Root definition node of the configuration
 		const char*								pScan = nullptr;									//  Scanning pointer
+		size_t									TextLen = 0;										//  Attribute value length
 		char									TempFN[MAX_PATH] = {};								//  Temp file name
 
 		//  Safety/Validity
@@ -394,6 +423,10 @@ private:
 			return;
 		}
 
+		//  Determine if the cycles are to be performed in memory
+		pScan = JAANode.getAttribute("inmemory", TextLen);
+		if (pScan != nullptr && _strnicmp(pScan, TRUE_PVAL, TextLen) == 0) InMemory = true;
+
 		//
 		//  Get the images directory name (if present), if not present set it to "images"
 		//
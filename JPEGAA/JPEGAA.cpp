@@ -2,7 +2,7 @@
 //*																													*
 //*   File:       JPEGAA.cpp																						*
 //*   Suite:      Experimental Algorithms																			*
-//*   Version:    1.0.0	(Build: 01)																					*
+//*   Version:    1.1.0	(Build: 02)																					*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2025 Ian J. Tree																				*
@@ -28,6 +28,7 @@
 //*   History:																										*
 //*																													*
 //*	1.0.0 -		17/04/2025	-	Initial Release																		*
+//*	1.1.0 -		16/10/2026	-	Pipelined cycle output & in-memory cycles											*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -85,15 +86,21 @@ int main(int argc, char* argv[])
 //
 //  NOTES:
 //
+//	1.	The cycles are pipelined, the output of a cycle (documentation and bitmap) only needs the reloaded image so it is
+//		produced on a separate thread while the next cycle encodes the same image.
+//
 
 void	runExperiment(JAACfg& Config) {
 	xymorg::Train<xymorg::RGB>*		pCurrImg = nullptr;								//  Pointer to the train of the current image
+	xymorg::Train<xymorg::RGB>*		pNextImg = nullptr;								//  Pointer to the train of the next image
 	int								CycleNo = 0;									//  Encoding cycle number
+	CYCLEOUTPUT						Output;											//  Output of the previous cycle
 
 	//  Report the run configuration
 	Config.Log << "INFO: The experiment will use: '" << Config.getBaseImage() << "' as a base gif image." << std::endl;
 	Config.Log << "INFO: Intermediate images will be stored in the: '" << Config.getImgDir() << "' directory." << std::endl;
 	Config.Log << "INFO: The experiment will perform: " << Config.getCycles() << " cycles of JPEG encoding." << std::endl;
+	if (Config.isInMemory()) Config.Log << "INFO: The JPEG images will be encoded and decoded in memory." << std::endl;
 
 	//  Attempt to load the image into memory
 	pCurrImg = xymorg::GIF::loadImage(Config.getBaseImage(), Config.RMap);
@@ -124,7 +131,24 @@ void	runExperiment(JAACfg& Config) {
 
 	while (CycleNo < Config.getCycles() && pCurrImg != nullptr) {
 		CycleNo++;
-		pCurrImg = performEncodingCycle(CycleNo, pCurrImg, Config);
+		pNextImg = performEncodingCycle(CycleNo, pCurrImg, Config);
+
+		//  Complete the output of the previous cycle, it was produced while this cycle was being encoded
+		if (!completeCycleOutput(Output, Config)) {
+			delete pNextImg;
+			pNextImg = nullptr;
+		}
+
+		//  The current image is no longer in use, advance to the new image and start producing its output
+		delete pCurrImg;
+		pCurrImg = pNextImg;
+		if (pCurrImg != nullptr) startCycleOutput(Output, CycleNo, pCurrImg, Config);
+	}
+
+	//  Complete the output of the final cycle
+	if (!completeCycleOutput(Output, Config)) {
+		delete pCurrImg;
+		pCurrImg = nullptr;
 	}
 
 	//  Show cycles completed
@@ -154,7 +178,7 @@ void	runExperiment(JAACfg& Config) {
 //
 //  NOTES:
 // 
-//	1.	The input image train is consumed by this function
+//	1.	The output of the previous cycle is produced concurrently from its own copy of the image train
 //
 
 xymorg::Train<xymorg::RGB>* performEncodingCycle(int Cycle, xymorg::Train<xymorg::RGB>* pImgIn, JAACfg& Config) {
@@ -166,6 +190,9 @@ xymorg::Train<xymorg::RGB>* performEncodingCycle(int Cycle, xymorg::Train<xymorg
 
 	Config.Log << "INFO: Starting cycle: " << Cycle << " of JPEG encoding." << std::endl;
 
+	//  Perform the cycle without a file round trip if requested
+	if (Config.isInMemory()) return performInMemoryCycle(Cycle, pImgIn, Config);
+
 	//
 	//		Step #1  -  Save the input image as a JPEG (default encoding)
 	//
@@ -176,14 +203,10 @@ xymorg::Train<xymorg::RGB>* performEncodingCycle(int Cycle, xymorg::Train<xymorg
 	//  Save the image as a JPEG (default settings for encoding)
 	if (!xymorg::JPEG::storeImage(IFName, Config.RMap, pImgIn)) {
 		Config.Log << "ERROR: Failed to encode and store JPEG image: '" << IFName << "'." << std::endl;
-		delete pImgIn;
 		return nullptr;
 	}
 	Config.Log << "INFO: Image has been stored as a JPEG encoded image in: '" << IFName << "' on cycle: " << Cycle << "." << std::endl;
 
-	//  Delete the image
-	delete pImgIn;
-
 	//
 	//		Step #2  -  Reload the saved image
 	//
@@ -197,32 +220,174 @@ xymorg::Train<xymorg::RGB>* performEncodingCycle(int Cycle, xymorg::Train<xymorg
 
 	Config.Log << "INFO: The JPEG image: '" << IFName << "' has been successfully reloaded for cycle: " << Cycle << "." << std::endl;
 
+	//  Return the output image
+	return pImgOut;
+}
+
+//  performInMemoryCycle
+//
+//  This function will perform a single encoding cycle in memory, the image is decoded straight from the encoded buffer
+//
+//  PARAMETERS:
+// 
+//			int				-		Cycle number
+//			Train*			-		Pointer to the current (input) image train
+//			JAACfg&			-		Reference to the application configuration
+//
+//  RETURNS:
+// 
+//			Train*			-		Pointer to the new image train, nullptr if the encoding cycle failed
+//
+//  NOTES:
+// 
+//	1.	The output of the previous cycle is produced concurrently from its own copy of the image train
+//
+
+xymorg::Train<xymorg::RGB>* performInMemoryCycle(int Cycle, xymorg::Train<xymorg::RGB>* pImgIn, JAACfg& Config) {
+	xymorg::ResourceBuffer			Image;											//  In-memory JPEG image
+	xymorg::Train<xymorg::RGB>*		pImgOut = nullptr;								//  Pointer to the train of the output image
+
+	//
+	//		Step #1  -  Encode the input image as an in-memory JPEG (default encoding)
+	//
+
+	if (!xymorg::JPEG::storeImage(Image, pImgIn, 0)) {
+		Config.Log << "ERROR: Failed to encode the in-memory JPEG image on cycle: " << Cycle << "." << std::endl;
+		return nullptr;
+	}
+	Config.Log << "INFO: Image has been encoded as an in-memory JPEG image of: " << Image.getBytesWritten() << " bytes on cycle: " << Cycle << "." << std::endl;
+
+	//
+	//		Step #2  -  Decode the in-memory image
+	//
+
+	pImgOut = xymorg::JPEG::loadImage(Image.getData(), Image.getBytesWritten(), 0);
+	if (pImgOut == nullptr) {
+		Config.Log << "ERROR: Failed to decode the in-memory JPEG image on cycle: " << Cycle << "." << std::endl;
+		return nullptr;
+	}
+
+	Config.Log << "INFO: The in-memory JPEG image has been successfully decoded for cycle: " << Cycle << "." << std::endl;
+
+	//  Return the output image
+	return pImgOut;
+}
+
+//  startCycleOutput
+//
+//  This function will start producing the output of an encoding cycle on a separate thread
+//
+//  PARAMETERS:
+// 
+//			CYCLEOUTPUT&	-		Reference to the cycle output
+//			int				-		Cycle number
+//			Train*			-		Pointer to the reloaded image train of the cycle
+//			JAACfg&			-		Reference to the application configuration
+//
+//  RETURNS:
+//
+//  NOTES:
+// 
+//	1.	The producer is given a private copy of the image train and a writer for the bitmap, the next cycle reads
+//		the image train and the resource mapper is only used by the main thread.
+//
+
+void	startCycleOutput(CYCLEOUTPUT& Output, int Cycle, xymorg::Train<xymorg::RGB>* pImg, JAACfg& Config) {
+
+	//  Prepare the output
+	Output.Cycle = Cycle;
+	Output.pImg = new xymorg::Train<xymorg::RGB>(*pImg);
+	Output.Doc.str("");
+	Output.Doc.clear();
+	Output.BMPStored = false;
+	sprintf_s(Output.BMPName, MAX_PATH, "%s/JPC%.2i.bmp", Config.getImgDir(), Cycle);
+	Output.BMPWriter = Config.RMap.openResourceWriter(Output.BMPName);
+
+	//  Start the producer
+	Output.Producer = std::thread([&Output]() { produceCycleOutput(Output); });
+
+	//  Return to caller
+	return;
+}
+
+//  produceCycleOutput
+//
+//  This function will produce the output of an encoding cycle, it runs on the cycle output thread
+//
+//  PARAMETERS:
+// 
+//			CYCLEOUTPUT&	-		Reference to the cycle output
+//
+//  RETURNS:
+//
+//  NOTES:
+// 
+//	1.	The documentation is captured rather than logged so that the log is only written by the main thread
+//	2.	Only the cycle output is used, the configuration (and its resource mapper) belong to the main thread
+//
+
+void	produceCycleOutput(CYCLEOUTPUT& Output) {
+
 	//
 	//		Step #3  -  Document the reloaded image
 	// 
-	
-	Config.Log << xymorg::undecorate;
-	Config.Log << "JPEG Degeneration - Cycle: " << Cycle << std::endl;
-	if (Cycle > 9) Config.Log << "------------------------------" << std::endl;
-	else Config.Log << "-----------------------------" << std::endl;
-	Config.Log << std::endl;
-	pImgOut->document(Config.Log, true);
-	Config.Log << xymorg::decorate;
+
+	Output.Doc << "JPEG Degeneration - Cycle: " << Output.Cycle << std::endl;
+	if (Output.Cycle > 9) Output.Doc << "------------------------------" << std::endl;
+	else Output.Doc << "-----------------------------" << std::endl;
+	Output.Doc << std::endl;
+	Output.pImg->document(Output.Doc, true);
 
 	//
 	//		Step 4  -  Save a bitmap image of the current image cycle
 	//
 
-	//  Format the image file name
-	sprintf_s(IFName, MAX_PATH, "%s/JPC%.2i.bmp", Config.getImgDir(), Cycle);
+	if (Output.BMPWriter.isOpen()) Output.BMPStored = xymorg::BMP::storeImage(Output.BMPWriter, Output.pImg, 0);
+	if (!Output.BMPWriter.close()) Output.BMPStored = false;
 
-	//  Save the image
-	if (!xymorg::BMP::storeImage(IFName, Config.RMap, pImgOut)) {
-		Config.Log << "ERROR: Failed to store a bitmap of the loaded image to: '" << IFName << "'." << std::endl;
-		delete pImgOut;
-		return nullptr;
+	//  Return to caller
+	return;
+}
+
+//  completeCycleOutput
+//
+//  This function will wait for the output of an encoding cycle to be produced and report it
+//
+//  PARAMETERS:
+// 
+//			CYCLEOUTPUT&	-		Reference to the cycle output
+//			JAACfg&			-		Reference to the application configuration
+//
+//  RETURNS:
+// 
+//			bool			-		true if the output was produced (or none was pending), otherwise false
+//
+//  NOTES:
+//
+
+bool	completeCycleOutput(CYCLEOUTPUT& Output, JAACfg& Config) {
+	std::string			DocLine;															//  Line of the documentation
+
+	//  Nothing to complete
+	if (!Output.Producer.joinable()) return true;
+
+	//  Wait for the producer to finish and release its copy of the image
+	Output.Producer.join();
+	delete Output.pImg;
+	Output.pImg = nullptr;
+
+	//  Log the documentation of the image (one log record per line)
+	Config.Log << xymorg::undecorate;
+	while (std::getline(Output.Doc, DocLine)) Config.Log << DocLine << std::endl;
+	Config.Log << xymorg::decorate;
+
+	//  Report a failure to store the bitmap
+	if (!Output.BMPStored) {
+		Config.Log << "ERROR: Failed to store a bitmap of the loaded image to: '" << Output.BMPName << "'." << std::endl;
+		Config.RMap.deleteResource(Output.BMPName);
+		return false;
 	}
 
-	//  Return the output image
-	return pImgOut;
+	//  Return showing success
+	return true;
 }
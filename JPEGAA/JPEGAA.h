@@ -3,7 +3,7 @@
 //*																													*
 //*   File:       JPEGAA.h																							*
 //*   Suite:      Experimental Algorithms																			*
-//*   Version:    1.0.0	(Build: 01)																					*
+//*   Version:    1.1.0	(Build: 02)																					*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2025 Ian J. Tree																				*
@@ -29,6 +29,7 @@
 //*   History:																										*
 //*																													*
 //*	1.0.0 -		17/04/2025	-	Initial Release																		*
+//*	1.1.0 -		16/10/2026	-	Pipelined cycle output & in-memory cycles											*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -38,6 +39,9 @@
 #define		XY_NEEDS_BMP
 #define		XY_NEEDS_JPEG
 
+//  Include standard headers
+#include	<sstream>																		//  String streams
+
 //  Include xymorg headers
 #include	"../xymorg/xymorg.h"															//  xymorg system headers
 
@@ -48,11 +52,26 @@
 constexpr auto		APP_NAME = "JPEGAA";
 constexpr auto		APP_TITLE = "JPEG Ad Absurdum";
 #ifdef _DEBUG
-constexpr auto		APP_VERSION = "1.0.0 build: 01 Debug";
+constexpr auto		APP_VERSION = "1.1.0 build: 02 Debug";
 #else
-constexpr auto		APP_VERSION = "1.0.0 build: 01";
+constexpr auto		APP_VERSION = "1.1.0 build: 02";
 #endif
 
+//  Deferred output of an encoding cycle (documentation and bitmap), produced while the next cycle is encoded
+typedef struct CycleOutput {
+	int								Cycle;												//  Cycle number
+	xymorg::Train<xymorg::RGB>*		pImg;												//  Pointer to a private copy of the reloaded image train
+	std::stringstream				Doc;												//  Documentation of the reloaded image
+	bool							BMPStored;											//  The bitmap image was stored
+	char							BMPName[MAX_PATH];									//  Bitmap image file name
+	xymorg::ResourceWriter			BMPWriter;											//  Writer for the bitmap image (opened by the main thread)
+	std::thread						Producer;											//  Thread producing the output
+} CYCLEOUTPUT;
+
 //  Forward Declarations/ Function Prototypes
 void		runExperiment(JAACfg& Config);																			//  Run the experiment
 xymorg::Train<xymorg::RGB>* performEncodingCycle(int Cycle, xymorg::Train<xymorg::RGB>* pImgIn, JAACfg& Config);	//  Perform an encoding cycle
+xymorg::Train<xymorg::RGB>* performInMemoryCycle(int Cycle, xymorg::Train<xymorg::RGB>* pImgIn, JAACfg& Config);	//  Perform an in-memory encoding cycle
+void		startCycleOutput(CYCLEOUTPUT& Output, int Cycle, xymorg::Train<xymorg::RGB>* pImg, JAACfg& Config);		//  Start producing the cycle output
+void		produceCycleOutput(CYCLEOUTPUT& Output);																//  Produce the cycle output
+bool		completeCycleOutput(CYCLEOUTPUT& Output, JAACfg& Config);												//  Complete and report the cycle output
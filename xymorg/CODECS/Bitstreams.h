@@ -444,6 +444,61 @@ namespace xymorg {
 			return;
 		}
 
+		//  refill
+		//
+		//  Tops up an MSB aligned 64 bit reservoir with as many whole bytes from the stream as will fit.
+		//
+		//  PARAMETERS
+		//
+		//		uint64_t&		-		Reference to the bit reservoir (next bit is the MSB)
+		//		uint32_t&		-		Reference to the count of valid bits in the reservoir
+		//
+		//	RETURNS
+		//
+		//	NOTES
+		//
+		//		1.		Bits below the valid count in the reservoir MUST be zero.
+		//
+
+		virtual void refill(uint64_t& Reservoir, uint32_t& Bits) {
+
+			while (Bits <= 56 && !EndOfStream) {
+				Reservoir |= uint64_t(next()) << (56 - Bits);
+				Bits += 8;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  drain
+		//
+		//  Writes all of the whole bytes held in an MSB aligned 64 bit reservoir to the stream.
+		//
+		//  PARAMETERS
+		//
+		//		uint64_t&		-		Reference to the bit reservoir (first bit to write is the MSB)
+		//		uint32_t&		-		Reference to the count of valid bits in the reservoir
+		//
+		//	RETURNS
+		//
+		//	NOTES
+		//
+		//		1.		On return the reservoir holds fewer than 8 valid bits, still MSB aligned.
+		//
+
+		virtual void drain(uint64_t& Reservoir, uint32_t& Bits) {
+
+			while (Bits >= 8) {
+				next(BYTE(Reservoir >> 56));
+				Reservoir <<= 8;
+				Bits -= 8;
+			}
+
+			//  Return to caller
+			return;
+		}
+
 		//  Buffer management functions
 
 		//  Getters & Setters for members
@@ -1283,6 +1338,112 @@ namespace xymorg {
 			return;
 		}
 
+		//  refill
+		//
+		//  Tops up an MSB aligned 64 bit reservoir with as many whole (destuffed) bytes from the stream as will fit.
+		//
+		//  PARAMETERS
+		//
+		//		uint64_t&		-		Reference to the bit reservoir (next bit is the MSB)
+		//		uint32_t&		-		Reference to the count of valid bits in the reservoir
+		//
+		//	RETURNS
+		//
+		//	NOTES
+		//
+		//		1.		Works directly on the underlying buffer rather than through next(), a single call loads up to
+		//				7 bytes into the reservoir.
+		//		2.		Restart markers are skipped, any other marker ends the stream (as for next()).
+		//
+
+		virtual void refill(uint64_t& Reservoir, uint32_t& Bits) {
+			BYTE		Byte = 0;																	//  Next byte
+
+			if (Buffer == nullptr) return;
+
+			while (Bits <= 56 && !EndOfStream) {
+				Byte = Buffer[BytesRead];
+
+				if (Byte != 0xFF) BytesRead++;
+				else {
+					//  A trailing 0xFF is treated as stuffed
+					if ((BytesRead + 1) >= BufferSize || Buffer[BytesRead + 1] == 0x00) BytesRead += 2;
+					else if ((Buffer[BytesRead + 1] & 0xF8) == 0xD0) {
+						//  Skip the restart marker
+						BytesRead += 2;
+						if (BytesRead >= BufferSize) {
+							BytesRead = BufferSize;
+							EndOfStream = true;
+						}
+						continue;
+					}
+					else {
+						//  Marker - end of the entropy coded data
+						EndOfStream = true;
+						break;
+					}
+				}
+
+				Reservoir |= uint64_t(Byte) << (56 - Bits);
+				Bits += 8;
+
+				if (BytesRead >= BufferSize) {
+					BytesRead = BufferSize;
+					EndOfStream = true;
+				}
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  drain
+		//
+		//  Writes all of the whole bytes held in an MSB aligned 64 bit reservoir to the stream, stuffing as needed.
+		//
+		//  PARAMETERS
+		//
+		//		uint64_t&		-		Reference to the bit reservoir (first bit to write is the MSB)
+		//		uint32_t&		-		Reference to the count of valid bits in the reservoir
+		//
+		//	RETURNS
+		//
+		//	NOTES
+		//
+		//		1.		Four bytes at a time are stored directly when none of them is 0xFF and there is room in the
+		//				buffer, otherwise the bytes are written singly with stuffing.
+		//
+
+		virtual void drain(uint64_t& Reservoir, uint32_t& Bits) {
+			uint32_t		Word = 0;																//  Next four bytes
+			uint32_t		Inv = 0;																//  Inverted bytes
+
+			while (Bits >= 32 && Buffer != nullptr && !EndOfStream && (BytesWritten + 4) < BufferSize) {
+				Word = uint32_t(Reservoir >> 32);
+
+				//  A 0xFF byte in the word is a zero byte in the inverse
+				Inv = ~Word;
+				if (((Inv - 0x01010101) & ~Inv & 0x80808080) != 0) break;
+
+				Buffer[BytesWritten] = BYTE(Word >> 24);
+				Buffer[BytesWritten + 1] = BYTE(Word >> 16);
+				Buffer[BytesWritten + 2] = BYTE(Word >> 8);
+				Buffer[BytesWritten + 3] = BYTE(Word);
+				BytesWritten += 4;
+				Reservoir <<= 32;
+				Bits -= 32;
+			}
+
+			while (Bits >= 8) {
+				StuffedStream::next(BYTE(Reservoir >> 56));
+				Reservoir <<= 8;
+				Bits -= 8;
+			}
+
+			//  Return to caller
+			return;
+		}
+
 		//
 		//  advance, retreat and peek api is NOT supported on a stuffed stream
 		//
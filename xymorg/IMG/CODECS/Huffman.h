@@ -78,6 +78,7 @@ namespace xymorg {
 
 		class Emitter;
 		class JPEGEmitter;
+		class JPEGScanReader;
 		class Collecter;
 		class JPEGCollecter;
 		class HuffmanTree;
@@ -199,6 +200,28 @@ namespace xymorg {
 			return JPEGEmitter(*this, bsIn);
 		}
 
+		//  readJPEGScan
+		//
+		//	Sets the CODEC up to read symbols and bit strings from a JPEG scan that is not a simple sequence of
+		//  coefficients (progressive scans).
+		//
+		//  PARAMETERS
+		//
+		//		ByteStream&					-	Reference to an input ByteStream
+		//
+		//  RETURNS
+		//
+		//		JPEGScanReader				-	Scan Reader
+		//
+		//  NOTES
+		//
+
+		JPEGScanReader	readJPEGScan(ByteStream& bsIn) {
+
+			//  Return the Reader
+			return JPEGScanReader(*this, bsIn);
+		}
+
 		//  Encoding Functions
 
 		//  encode
@@ -282,6 +305,8 @@ public:
 		//*                                                                                                                 *
 		//*******************************************************************************************************************
 
+		static const int	DLUT_BITS = 9;															//  Lookahead bits in the primary decode table
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Forward Declarations                                                                                          *
@@ -302,6 +327,14 @@ public:
 			CurrentNode = nullptr;
 			ELUTBuilt = false;
 			memset(ELUT, 0, 256 * sizeof(HuffmanNode*));
+			DLUTBuilt = false;
+			memset(DLUT, 0, sizeof(DLUT));
+			memset(MaxCode, 0, sizeof(MaxCode));
+			memset(ValOffset, 0, sizeof(ValOffset));
+			memset(DSymbols, 0, sizeof(DSymbols));
+			ECTBuilt = false;
+			memset(ECode, 0, sizeof(ECode));
+			memset(ELength, 0, sizeof(ELength));
 			return;
 		}
 
@@ -365,6 +398,40 @@ public:
 			return CurrentNode->isLeaf();
 		}
 
+		//  decode
+		//
+		//  Progressive decoding from a position held by the caller, accepts the next bit from the bit stream and moves
+		//  the position on in the tree, returns true once the position reaches a leaf node.
+		//
+		//	PARAMETERS:
+		//
+		//		HuffmanNode*&	-		Reference to the caller's position in the tree (nullptr to start at the root)
+		//		bool			-		Next bit value from the bit stream
+		//
+		//	RETURNS:
+		//
+		//		bool			-		true if positioned at a leaf node, otherwise false
+		//
+		//  NOTES:
+		//
+		//  The tree is not modified, so decoders running concurrently can share it.
+		//
+
+		bool	decode(HuffmanNode*& Cursor, bool NextBit) const {
+			if (Cursor == nullptr) Cursor = RootNode;
+			if (Cursor == nullptr) return true;
+			if (NextBit) {
+				if (Cursor->getOne() == nullptr) return true;
+				Cursor = Cursor->getOne();
+			}
+			else {
+				if (Cursor->getZero() == nullptr) return true;
+				Cursor = Cursor->getZero();
+			}
+
+			return Cursor->isLeaf();
+		}
+
 		//  getDecode
 		//
 		//  Returns the decoded byte at the leaf node of the current position in the tree.
@@ -387,8 +454,162 @@ public:
 			return Symbol;
 		}
 
+		//  hasDLUT
+		//
+		//  Determines if the table driven decoder is available for this tree
+		//
+		//	PARAMETERS:
+		//
+		//	RETURNS:
+		//
+		//		bool			-		true if the decode lookup tables have been built, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	hasDLUT() const { return DLUTBuilt; }
+
+		//  lookup
+		//
+		//  Decodes the next symbol from the passed 16 bit lookahead using the decode lookup tables.
+		//
+		//	PARAMETERS:
+		//
+		//		uint32_t		-		Next 16 bits of the stream (MSB first, right aligned)
+		//		BYTE&			-		Reference to the variable to receive the decoded symbol
+		//
+		//	RETURNS:
+		//
+		//		int				-		Length of the code consumed (bits), 0 if the lookahead is not a valid code
+		//
+		//  NOTES:
+		//
+		//  Codes of up to DLUT_BITS are resolved with a single table access, longer codes fall through to a
+		//  search of the per-length maximum code values.
+		//
+
+		int		lookup(uint32_t Peek, BYTE& Symbol) const {
+			uint16_t	Entry = DLUT[Peek >> (16 - DLUT_BITS)];									//  Primary table entry
+			int32_t		Code = 0;																//  Code at the current length
+
+			//  Short code - resolved by the primary table
+			if (Entry != 0) {
+				Symbol = BYTE(Entry & 0xFF);
+				return int(Entry >> 8);
+			}
+
+			//  Long code - search the remaining lengths
+			for (int Length = DLUT_BITS + 1; Length <= 16; Length++) {
+				Code = int32_t(Peek >> (16 - Length));
+				if (Code <= MaxCode[Length]) {
+					Symbol = DSymbols[(ValOffset[Length] + Code) & 0xFF];
+					return Length;
+				}
+			}
+
+			//  Invalid code
+			Symbol = 0;
+			return 0;
+		}
+
+		//  buildDLUT
+		//
+		//  Builds the decode lookup tables from a canonical definition of the code (count of codes of each length
+		//  followed by the symbols in code order).
+		//
+		//	PARAMETERS:
+		//
+		//		BYTE*			-		Pointer to the array of 16 counts of codes of length 1 - 16
+		//		BYTE*			-		Pointer to the array of symbols
+		//
+		//	RETURNS:
+		//
+		//  NOTES:
+		//
+		//  The canonical code assigns consecutive codes at each length, starting from the (left shifted) successor
+		//  of the last code of the previous length, this is the same layout that a zero first explosion produces.
+		//
+
+		void	buildDLUT(const BYTE* Counts, const BYTE* Symbols) {
+			int32_t		Code = 0;																//  Next code
+			int			SymIndex = 0;															//  Symbol index
+
+			memset(DLUT, 0, sizeof(DLUT));
+			for (int Length = 0; Length < 18; Length++) MaxCode[Length] = -1;
+
+			for (int Length = 1; Length <= 16; Length++) {
+				ValOffset[Length] = SymIndex - Code;
+
+				for (int CX = 0; CX < Counts[Length - 1]; CX++) {
+					//  An over-subscribed (invalid) definition is truncated at the end of the code space
+					if (SymIndex > 255 || Code >= (1 << Length)) break;
+					DSymbols[SymIndex] = Symbols[SymIndex];
+
+					//  Short codes populate every primary table slot that they prefix
+					if (Length <= DLUT_BITS) {
+						int		First = Code << (DLUT_BITS - Length);
+						int		Slots = 1 << (DLUT_BITS - Length);
+						for (int SX = 0; SX < Slots; SX++) DLUT[First + SX] = uint16_t((Length << 8) | Symbols[SymIndex]);
+					}
+
+					Code++;
+					SymIndex++;
+				}
+
+				if (Counts[Length - 1] > 0) MaxCode[Length] = Code - 1;
+				Code <<= 1;
+			}
+
+			DLUTBuilt = true;
+
+			//  Return to caller
+			return;
+		}
+
 		//  Encoding Functions
 
+		//  buildECT
+		//
+		//  Builds the flat encode code and length tables from a canonical definition of the code (count of codes of
+		//  each length followed by the symbols in code order).
+		//
+		//	PARAMETERS:
+		//
+		//		BYTE*			-		Pointer to the array of 16 counts of codes of length 1 - 16
+		//		BYTE*			-		Pointer to the array of symbols
+		//
+		//	RETURNS:
+		//
+		//  NOTES:
+		//
+		//  Once built, encode() resolves a symbol with a pair of table reads instead of climbing from the leaf
+		//  to the root of the tree.
+		//
+
+		void	buildECT(const BYTE* Counts, const BYTE* Symbols) {
+			uint32_t	Code = 0;																//  Next code
+			int			SymIndex = 0;															//  Symbol index
+
+			memset(ECode, 0, sizeof(ECode));
+			memset(ELength, 0, sizeof(ELength));
+
+			for (int Length = 1; Length <= 16; Length++) {
+				for (int CX = 0; CX < Counts[Length - 1]; CX++) {
+					if (SymIndex > 255) break;
+					ECode[Symbols[SymIndex]] = uint16_t(Code);
+					ELength[Symbols[SymIndex]] = BYTE(Length);
+					Code++;
+					SymIndex++;
+				}
+				Code <<= 1;
+			}
+
+			ECTBuilt = true;
+
+			//  Return to caller
+			return;
+		}
+
 		//  encode
 		//
 		//  Returns the passed value encoded against the current tree structure.
@@ -407,6 +628,13 @@ public:
 		EncodedUnit	encode(BYTE Symbol) {
 			EncodedUnit		Encode = { 0, 0 };
 
+			//  Use the flat code tables when they are available
+			if (ECTBuilt) {
+				Encode.Length = ELength[Symbol];
+				Encode.Bits = ECode[Symbol];
+				return Encode;
+			}
+
 			//  If the encode lookup table has not yet been built then build it
 			if (!ELUTBuilt) buildELUT();
 
@@ -475,6 +703,18 @@ public:
 		bool				ELUTBuilt;																//  Table has been built
 		HuffmanNode*		ELUT[256];																//  Array of node pointers
 
+		//  Decoding lookup tables
+		bool				DLUTBuilt;																//  Tables have been built
+		uint16_t			DLUT[1 << DLUT_BITS];													//  Primary table (Length << 8 | Symbol)
+		int32_t				MaxCode[18];															//  Largest code of each length (-1 none)
+		int					ValOffset[18];															//  Symbol index offset for each length
+		BYTE				DSymbols[256];															//  Symbols in code order
+
+		//  Encoding code tables
+		bool				ECTBuilt;																//  Tables have been built
+		uint16_t			ECode[256];																//  Code for each symbol (right aligned)
+		BYTE				ELength[256];															//  Code length for each symbol (0 none)
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Private Functions                                                                                             *
@@ -1118,7 +1358,7 @@ public:
 			//
 
 			JPEGCollecter(Huffman& Parent, ByteStream& bsOut)
-				: CODEC(Parent), BStream(bsOut, true), ACCount(0) {
+				: CODEC(Parent), BStream(bsOut), Reservoir(0), ResBits(0), ACCount(0) {
 
 				memset(&Current, 0, sizeof(JCEU));
 
@@ -1233,10 +1473,15 @@ public:
 			//
 			//  NOTES
 			//
+			//  Any partial final byte is padded with 1 bits.
 			//
 
 			void signalEndOfStream() {
 
+				//  Pad the final byte and write the remaining bits
+				if ((ResBits & 7) != 0) putBits(0xFF >> (ResBits & 7), 8 - (ResBits & 7));
+				BStream.drain(Reservoir, ResBits);
+
 				//  Flush the stream
 				BStream.flush();
 
@@ -1253,10 +1498,11 @@ public:
 			//*******************************************************************************************************************
 
 			Huffman&			CODEC;																	//  Parent CODEC
-			MSBitStream			BStream;																//  Output Bit Stream
+			ByteStream&			BStream;																//  Output Byte Stream
+			uint64_t			Reservoir;																//  Bit accumulator (MSB aligned)
+			uint32_t			ResBits;																//  Valid bits in the accumulator
 
 			//  State controls
-	//  State controls
 			JCEU				Current;																//  Current JPEG Encoding Unit
 			size_t				ACCount;																//  Count of ACs 
 
@@ -1281,7 +1527,6 @@ public:
 			//
 
 			void		writeCurrentUnit(bool IsDC) {
-				JCEU		Pad16 = { 15, 0, 0, 0, 0 };
 				EncodedUnit	EncodedCat = {};											//  Huffman encoded category
 
 				//  Detect the condition where we are signalling End-Of-Unit (all remaining values are zero)
@@ -1298,22 +1543,19 @@ public:
 						Current.Zeroes = 0;
 					}
 					else {
-						//  Emit units of 16 zeroes at a time
+						//  Emit a ZRL (run of 16 zeroes) for each complete run of 16 zeroes
 						while (Current.Zeroes > 15) {
-							EncodedCat = CODEC.CurrentTree->encode((Current.Zeroes << 4) + Current.Category);
-							BStream.next(EncodedCat.Bits, EncodedCat.Length);
-							if (Current.Category > 0) BStream.next(Current.Sign, 1);
-							if (Current.Category > 1) BStream.next(Current.Magnitude, Current.Bits);
+							EncodedCat = CODEC.CurrentTree->encode(0xF0);
+							putBits(EncodedCat.Bits, EncodedCat.Length);
 							Current.Zeroes = Current.Zeroes - 16;
 						}
 					}
 				}
 
-				//  Write to the Connector
-				EncodedCat = CODEC.CurrentTree->encode((Current.Zeroes << 4) +  Current.Category);
-				BStream.next(EncodedCat.Bits, EncodedCat.Length);
-				if (Current.Category > 0) BStream.next(Current.Sign, 1);
-				if (Current.Category > 1) BStream.next(Current.Magnitude, Current.Bits);
+				//  Write to the accumulator
+				EncodedCat = CODEC.CurrentTree->encode(BYTE((Current.Zeroes << 4) + Current.Category));
+				putBits(EncodedCat.Bits, EncodedCat.Length);
+				if (Current.Category > 0) putBits((uint32_t(Current.Sign) << Current.Bits) | Current.Magnitude, Current.Bits + 1);
 
 				//  Clear the current encoded unit
 				memset(&Current, 0, sizeof(JCEU));
@@ -1322,6 +1564,33 @@ public:
 				return;
 			}
 
+			//  putBits
+			//
+			//  Appends a right aligned bit string to the accumulator, whole bytes are written out once 32 or more bits
+			//  are held.
+			//
+			//  PARAMETERS
+			//
+			//		uint32_t			-		Bits to append (right aligned)
+			//		uint32_t			-		Number of bits to append (0 - 17)
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//
+
+			void		putBits(uint32_t Bits, uint32_t Length) {
+
+				if (Length == 0) return;
+				Reservoir |= uint64_t(Bits & ((1u << Length) - 1)) << (64 - ResBits - Length);
+				ResBits += Length;
+				if (ResBits >= 32) BStream.drain(Reservoir, ResBits);
+
+				//  Return to caller
+				return;
+			}
+
 			//  encodeCoefficient
 			//
 			//  Encodes the coefficient and any preceding zeroes into the current unit
@@ -1422,10 +1691,12 @@ public:
 			//
 
 			JPEGEmitter(Huffman& Parent, ByteStream& bsIn)
-				: CODEC(Parent), BStream(bsIn, false) {
+				: CODEC(Parent), BStream(bsIn) {
 
 				//  Clear members to default state
 				memset(&Current, 0, sizeof(JCEU));
+				Reservoir = 0;
+				ResBits = 0;
 
 				//  Return to caller
 				return;
@@ -1468,7 +1739,7 @@ public:
 
 			bool eos() {
 				if (Current.Zeroes >= 0 && Current.Zeroes != 255) return false;
-				return BStream.eos();
+				return exhausted();
 			}
 
 			//  hasNext
@@ -1497,7 +1768,7 @@ public:
 					memset(&Current, 0, sizeof(JCEU));
 				}
 
-				if (!BStream.eos()) {
+				if (!exhausted()) {
 					readCurrentUnit(ExpectDC);
 					return true;
 				}
@@ -1575,7 +1846,11 @@ public:
 			//*******************************************************************************************************************
 
 			Huffman&				CODEC;																	//  Parent CODEC
-			MSBitStream				BStream;																//  Input Bit Stream
+			ByteStream&				BStream;																//  Input Byte Stream
+
+			//  Bit reservoir (MSB first)
+			uint64_t				Reservoir;																//  Buffered bits
+			uint32_t				ResBits;																//  Count of buffered bits
 
 			//  Current JCEU
 			JCEU					Current;
@@ -1601,30 +1876,52 @@ public:
 			//
 
 			void		readCurrentUnit(bool ExpectDC) {
+				BYTE		Symbol = 0;																	//  Decoded symbol
+				int			Length = 0;																	//  Length of the code
+				bool		Decoded = false;															//  Symbol was decoded
 
-				if (!BStream.eos()) {		
-					//  Clear current position in the Huffman tree
-					CODEC.CurrentTree->setCurrentNode(nullptr);
+				if (!exhausted()) {		
 					memset(&Current, 0, sizeof(JCEU));
 
-					while (!BStream.eos()) {
-						bool NextBit = false;
-						if (BStream.next(1) == 1) NextBit = true;
-						if (CODEC.CurrentTree->decode(NextBit)) {
-							//  Store the category
-							Current.Category = CODEC.CurrentTree->getDecode();
-					
-							//  Read the sign and magnitude
-							if (!ExpectDC) {
-								Current.Zeroes = Current.Category / 16;
-								Current.Category = Current.Category % 16;
+					if (CODEC.CurrentTree->hasDLUT()) {
+						//  Table driven decode from a 16 bit lookahead
+						if (ResBits < 16) BStream.refill(Reservoir, ResBits);
+						Length = CODEC.CurrentTree->lookup(uint32_t(Reservoir >> 48), Symbol);
+						if (Length > 0) Decoded = true;
+						else Length = 1;
+						consume(uint32_t(Length));
+					}
+					else {
+						//  Walk the tree from the root, the position is held locally as the tree may be shared
+						HuffmanTree::HuffmanNode*	Cursor = nullptr;									//  Position in the tree
+
+						while (!exhausted()) {
+							bool NextBit = false;
+							if (readBits(1) == 1) NextBit = true;
+							if (CODEC.CurrentTree->decode(Cursor, NextBit)) {
+								if (Cursor != nullptr) Symbol = Cursor->getSymbol();
+								Decoded = true;
+								break;
 							}
-							if (Current.Category > 0) Current.Bits = Current.Category - 1;
-							if (Current.Category > 0) Current.Sign = BYTE(BStream.next(1));
-							if (Current.Category > 1) Current.Magnitude = BStream.next(Current.Bits);
-							break;
 						}
 					}
+
+					if (Decoded) {
+						//  Store the category
+						Current.Category = Symbol;
+
+						//  Read the sign and magnitude
+						if (!ExpectDC) {
+							Current.Zeroes = Current.Category / 16;
+							Current.Category = Current.Category % 16;
+						}
+
+						//  A DC category above 15 can only come from a corrupt table, it is decoded as a zero difference
+						if (Current.Category > 15) Current.Category = 0;
+						if (Current.Category > 0) Current.Bits = Current.Category - 1;
+						if (Current.Category > 0) Current.Sign = BYTE(readBits(1));
+						if (Current.Category > 1) Current.Magnitude = readBits(Current.Bits);
+					}
 				}
 
 				//  If an End-Of-Unit was read set the zero count to 63
@@ -1634,6 +1931,75 @@ public:
 				return;
 			}
 
+			//  exhausted
+			//
+			//  Determines if all of the input bits have been consumed
+			//
+			//  PARAMETERS
+			//
+			//  RETURNS
+			//
+			//		bool			-		true if the input stream and the bit reservoir are both empty
+			//
+			//  NOTES
+			//
+			//
+
+			bool		exhausted() {
+				if (ResBits > 0) return false;
+				if (!BStream.eos()) BStream.refill(Reservoir, ResBits);
+				return ResBits == 0;
+			}
+
+			//  readBits
+			//
+			//  Reads the next bit string from the bit reservoir
+			//
+			//  PARAMETERS
+			//
+			//		uint32_t		-		Number of bits to read (0 - 32)
+			//
+			//  RETURNS
+			//
+			//		uint32_t		-		Bit string, zero bits are returned once the input is exhausted
+			//
+			//  NOTES
+			//
+			//
+
+			uint32_t	readBits(uint32_t Bits) {
+				uint32_t		Value = 0;																	//  Bit string
+
+				if (Bits == 0) return 0;
+				if (ResBits < Bits) BStream.refill(Reservoir, ResBits);
+				Value = uint32_t(Reservoir >> (64 - Bits));
+				consume(Bits);
+				return Value;
+			}
+
+			//  consume
+			//
+			//  Discards bits from the front of the bit reservoir
+			//
+			//  PARAMETERS
+			//
+			//		uint32_t		-		Number of bits to discard (1 - 63)
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//
+
+			void		consume(uint32_t Bits) {
+				Reservoir <<= Bits;
+				if (Bits > ResBits) ResBits = 0;
+				else ResBits -= Bits;
+
+				//  Return to caller
+				return;
+			}
+
 			//  decodeCoefficient
 			//
 			//  Decodes the value in the current JPEG Encoding Unit to a Coefficient value
@@ -1664,6 +2030,242 @@ public:
 
 		};
 
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   JPEGScanReader Class																							*
+		//*                                                                                                                 *
+		//*   The Scan Reader provides the primitive operations for decoding a JPEG scan in which the coefficients of a	*
+		//*	  DU are spread across several scans (progressive). Huffman encoded symbols and the raw bit strings that		*
+		//*   follow them are read on demand, the interpretation of the symbols is left to the caller.					*
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		class JPEGScanReader {
+		public:
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Constructors                                                                                                  *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  Normal Constructor
+			//
+			//  Constructs a new Scan Reader
+			//
+			//  PARAMETERS
+			//
+			//		Huffman&		-		Reference to the parent Huffman CODEC obect
+			//		ByteStream&		-		Reference to the Input ByteStream
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//
+
+			JPEGScanReader(Huffman& Parent, ByteStream& bsIn)
+				: CODEC(Parent), BStream(bsIn), Reservoir(0), ResBits(0) {
+
+				//  Return to caller
+				return;
+			}
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Destructor                                                                                                    *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			~JPEGScanReader() {
+
+			}
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Public Functions                                                                                              *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  setTree
+			//
+			//  Sets the HuffmanTree object that is to be used for decoding symbols
+			//
+			//  PARAMETERS
+			//
+			//		HuffmanTree*		-		Pointer to the HuffmanTree to use for the following operations
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//
+
+			void setTree(HuffmanTree* NewTree) { CODEC.setTree(NewTree); return; }
+
+			//  exhausted
+			//
+			//  Determines if all of the input bits have been consumed
+			//
+			//  PARAMETERS
+			//
+			//  RETURNS
+			//
+			//		bool			-		true if the input stream and the bit reservoir are both empty
+			//
+			//  NOTES
+			//
+			//
+
+			bool		exhausted() {
+				if (ResBits > 0) return false;
+				if (!BStream.eos()) BStream.refill(Reservoir, ResBits);
+				return ResBits == 0;
+			}
+
+			//  nextSymbol
+			//
+			//  Decodes the next Huffman encoded symbol using the current tree
+			//
+			//  PARAMETERS
+			//
+			//		BYTE&			-		Reference to the variable to receive the decoded symbol
+			//
+			//  RETURNS
+			//
+			//		bool			-		true if a symbol was decoded, false if the input is exhausted or the code is invalid
+			//
+			//  NOTES
+			//
+			//
+
+			bool		nextSymbol(BYTE& Symbol) {
+				int			Length = 0;																	//  Length of the code
+
+				if (exhausted()) return false;
+
+				if (CODEC.CurrentTree->hasDLUT()) {
+					//  Table driven decode from a 16 bit lookahead
+					if (ResBits < 16) BStream.refill(Reservoir, ResBits);
+					Length = CODEC.CurrentTree->lookup(uint32_t(Reservoir >> 48), Symbol);
+					if (Length == 0) return false;
+					consume(uint32_t(Length));
+					return true;
+				}
+
+				//  Walk the tree one bit at a time, the position is held locally as the tree may be shared
+				HuffmanTree::HuffmanNode*	Cursor = nullptr;											//  Position in the tree
+				while (!exhausted()) {
+					if (CODEC.CurrentTree->decode(Cursor, readBits(1) == 1)) {
+						Symbol = 0;
+						if (Cursor != nullptr) Symbol = Cursor->getSymbol();
+						return true;
+					}
+				}
+
+				//  Input ran out within a code
+				return false;
+			}
+
+			//  readBits
+			//
+			//  Reads the next bit string from the bit reservoir
+			//
+			//  PARAMETERS
+			//
+			//		uint32_t		-		Number of bits to read (0 - 32)
+			//
+			//  RETURNS
+			//
+			//		uint32_t		-		Bit string, zero bits are returned once the input is exhausted
+			//
+			//  NOTES
+			//
+			//
+
+			uint32_t	readBits(uint32_t Bits) {
+				uint32_t		Value = 0;																	//  Bit string
+
+				if (Bits == 0) return 0;
+				if (ResBits < Bits) BStream.refill(Reservoir, ResBits);
+				Value = uint32_t(Reservoir >> (64 - Bits));
+				consume(Bits);
+				return Value;
+			}
+
+			//  readCoefficient
+			//
+			//  Reads the magnitude bits of a coefficient of the passed category and returns the signed value
+			//
+			//  PARAMETERS
+			//
+			//		int				-		Category (bits of significance) of the coefficient (0 - 15)
+			//
+			//  RETURNS
+			//
+			//		int				-		Coefficient value
+			//
+			//  NOTES
+			//
+			//  A leading zero bit indicates a negative coefficient (ITU-T T.81 F.2.2.1 EXTEND). A category outside the
+			//  legal range (from a corrupt table) yields zero.
+			//
+
+			int			readCoefficient(int Category) {
+				int			Value = 0;																	//  Coefficient value
+
+				if (Category <= 0 || Category > 15) return 0;
+				Value = int(readBits(uint32_t(Category)));
+				if (Value < (1 << (Category - 1))) Value -= (1 << Category) - 1;
+				return Value;
+			}
+
+		private:
+
+			//*******************************************************************************************************************
+			//*																													*
+			//*  Private Members																								*
+			//*																													*
+			//*******************************************************************************************************************
+
+			Huffman&				CODEC;																	//  Parent CODEC
+			ByteStream&				BStream;																//  Input Byte Stream
+
+			//  Bit reservoir (MSB first)
+			uint64_t				Reservoir;																//  Buffered bits
+			uint32_t				ResBits;																//  Count of buffered bits
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Private Functions                                                                                             *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  consume
+			//
+			//  Discards bits from the front of the bit reservoir
+			//
+			//  PARAMETERS
+			//
+			//		uint32_t		-		Number of bits to discard (1 - 63)
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//
+
+			void		consume(uint32_t Bits) {
+				Reservoir <<= Bits;
+				if (Bits > ResBits) ResBits = 0;
+				else ResBits -= Bits;
+
+				//  Return to caller
+				return;
+			}
+
+		};
+
 	};
 
 }
@@ -23,6 +23,8 @@
 //*	1.0.0 - 26/09/2016   -  Initial version																			*
 //* 2.0.0 - 04/12/2014   -  Refactoring																				*
 //* 2.1.0 - 02/10/2020   -  Adapted to use the RasterBuffer                                                         *
+//* 2.1.1 - 16/10/2026   -  Bulk symbol emission through a lookup table												*
+//* 2.1.2 - 16/10/2026   -  Hashed string index for the encoder dictionary											*
 //*																													*
 //*******************************************************************************************************************
 
@@ -73,6 +75,13 @@ namespace xymorg {
 			LZWDictEntry	Entry[4096];												//  Array of dictionary entries
 		} LZWDictionary;
 
+		//  Encoder string index - hashed on (parent code, value) to locate a string extension in a single probe
+
+		typedef struct LZWHashSlot {
+			uint32_t		Key;														//  (Parent << 8) | Value
+			LZWCODE			Code;														//  Dictionary code, 0 if the slot is free
+		} LZWHashSlot;
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Private Constants			                                                                                    *
@@ -81,6 +90,8 @@ namespace xymorg {
 
 		static const int		MAX_LZW_STRINGSTACK = 4096;								//  Maximum sixe of the string stack
 		static const LZWCODE	MAX_LZW_CODE = 4095;									//  Maximum possible LZW code
+		static const int		LZW_HASH_BITS = 13;										//  Bits in the encoder hash index
+		static const size_t		LZW_HASH_SLOTS = size_t(1) << LZW_HASH_BITS;			//  Slots in the encoder hash index
 		
 	public:
 
@@ -115,6 +126,7 @@ namespace xymorg {
 
 			//  Clear the state to NULL
 			pDict = nullptr;
+			pHash = nullptr;
 			NativeCodeSize = 0;
 			Bits = 0;
 			CurrentCode = 0;
@@ -144,6 +156,12 @@ namespace xymorg {
 				pDict = nullptr;
 			}
 
+			//  Free the encoder string index (if it remains allocated)
+			if (pHash != nullptr) {
+				free(pHash);
+				pHash = nullptr;
+			}
+
 			//  Return to caller
 			return;
 		}
@@ -304,6 +322,9 @@ namespace xymorg {
 			//  Condition the CODEC and obtain the collector
 			Collecter	CIn = encode(bsOut, NCS);
 
+			//  Fail if the dictionary could not be allocated
+			if (pDict == nullptr) return false;
+
 			//  Set the clean termination to false
 			CleanTermination = false;
 
@@ -366,6 +387,14 @@ namespace xymorg {
 				Tokens = 0;
 			}
 
+			//  Allocate and clear the string index, without it the dictionary cannot be used
+			if (pHash == nullptr) pHash = (LZWHashSlot*) malloc(LZW_HASH_SLOTS * sizeof(LZWHashSlot));
+			if (pHash != nullptr) memset(pHash, 0, LZW_HASH_SLOTS * sizeof(LZWHashSlot));
+			else if (pDict != NULL) {
+				free(pDict);
+				pDict = NULL;
+			}
+
 			//  Return the Collecter
 			return Collecter(*this, bsOut);
 		}
@@ -398,7 +427,7 @@ namespace xymorg {
 		//  NOTES
 		//
 
-		bool		isDictionaryFull() { if (pDict->HiCode == MAX_LZW_CODE) return true; return false; }
+		bool		isDictionaryFull() { if (pDict == nullptr) return false; if (pDict->HiCode == MAX_LZW_CODE) return true; return false; }
 
 		//  getTokenCount
 		//
@@ -425,6 +454,7 @@ private:
 
 		//  Reference items for encoding/decoding
 		LZWDictionary*		pDict;																	//  LZW Dictionary
+		LZWHashSlot*		pHash;																	//  Encoder string index
 		int					NativeCodeSize;															//  Native symbol code size
 		int					Bits;																	//  Current bit width of the data stream
 		LZWCODE				CurrentCode;															//  Current code being peocessed from the stream
@@ -636,6 +666,46 @@ public:
 				return CODEC.pDict->pStringStack[--CODEC.pDict->StackIndex];
 			}
 
+			//  next
+			//
+			//  Emits up to the requested number of symbols from the decompressed stream, each symbol is mapped through
+			//  the passed lookup table
+			//
+			//  PARAMETERS
+			//
+			//		T*					-		Pointer to the output array
+			//		size_t				-		Number of symbols wanted
+			//		T*					-		Const pointer to the lookup table (256 entries, indexed by symbol)
+			//
+			//  RETURNS
+			//
+			//		size_t				-		Number of symbols emitted, less than requested only at the end-of-stream
+			//
+			//  NOTES
+			//
+			//		Decoded strings are copied from the string stack directly to the output.
+			//
+
+			template <typename T>
+			size_t next(T* pOut, size_t Count, const T* pLUT) {
+				size_t		Emitted = 0;														//  Symbols emitted
+				BYTE*		pStack = CODEC.pDict->pStringStack;									//  String stack
+				UINT		SX = 0;																//  Stack index
+
+				while (Emitted < Count) {
+					//  Decode the next string when the current one is exhausted
+					if (CODEC.pDict->StackIndex == 0 && !hasNext()) break;
+
+					//  Drain the string stack
+					SX = CODEC.pDict->StackIndex;
+					while (SX > 0 && Emitted < Count) pOut[Emitted++] = pLUT[pStack[--SX]];
+					CODEC.pDict->StackIndex = SX;
+				}
+
+				//  Return the number of symbols emitted
+				return Emitted;
+			}
+
 			//*******************************************************************************************************************
 			//*                                                                                                                 *
 			//*   Operator Overload Functions                                                                                   *
@@ -749,6 +819,9 @@ public:
 			Collecter(LZW& Parent, ByteStream& bsOut)
 				: CODEC(Parent), BStream(bsOut, true) {
 
+				//  Nothing is emitted if the dictionary could not be allocated
+				if (CODEC.pDict == nullptr) return;
+
 				//  Emit the initial CLEAR code to the compressed stream
 				BStream.next(CODEC.pDict->ClearCode, CODEC.Bits);
 				CODEC.Tokens++;
@@ -769,6 +842,11 @@ public:
 					CODEC.pDict = nullptr;
 				}
 
+				if (CODEC.pHash != nullptr) {
+					free(CODEC.pHash);
+					CODEC.pHash = nullptr;
+				}
+
 				//  Return to caller
 				return;
 			}
@@ -801,6 +879,9 @@ public:
 
 			void next(BYTE NextSymbol) {
 
+				//  Discard the symbol if the dictionary could not be allocated
+				if (CODEC.pDict == nullptr) return;
+
 				//  Save the input symbol
 				CODEC.NextCode = NextSymbol;
 
@@ -863,6 +944,7 @@ public:
 					CODEC.Tokens++;
 					CODEC.Bits = CODEC.NativeCodeSize + 1;
 					CODEC.pDict->HiCode = CODEC.pDict->EndCode;
+					memset(CODEC.pHash, 0, LZW_HASH_SLOTS * sizeof(LZWHashSlot));
 					CODEC.StartOfString = CODEC.NextCode;
 					CODEC.EndOfString = CODEC.NextCode;
 					return;
@@ -896,6 +978,9 @@ public:
 
 			void signalEndOfStream() {
 
+				//  Nothing to terminate if the dictionary could not be allocated
+				if (CODEC.pDict == nullptr) return;
+
 				//  Emit the final string to the compressed stream
 				BStream.next(CODEC.EndOfString, CODEC.Bits);
 				CODEC.Tokens++;
@@ -948,22 +1033,39 @@ public:
 			//
 
 			LZWCODE matchString(LZWCODE String, LZWCODE Code) {
-				USHORT			MatchEntry;									//  Entry we are attempting to match against
+				uint32_t		Key = (uint32_t(String) << 8) | BYTE(Code);				//  Key for the extended string
+				size_t			Slot = hashSlot(Key);									//  Slot being probed
 
-				//  Boundary condition - no strings in the table yet
-				if (CODEC.pDict->HiCode == CODEC.pDict->EndCode) return LZWCODE(CODEC.pDict->HiCode + 1);
-
-				//  Search the dictionary trying to locate an entry that has the String as a parent and the code as the next character
-				for (MatchEntry = CODEC.pDict->EndCode + 1; MatchEntry <= CODEC.pDict->HiCode; MatchEntry++)
-				{
-					if (CODEC.pDict->Entry[MatchEntry].Parent == String && CODEC.pDict->Entry[MatchEntry].Value == BYTE(Code)) break;
+				//  Probe the string index until a match or a free slot is found
+				while (CODEC.pHash[Slot].Code != 0) {
+					if (CODEC.pHash[Slot].Key == Key) return CODEC.pHash[Slot].Code;
+					Slot = (Slot + 1) & (LZW_HASH_SLOTS - 1);
 				}
 
-				if (MatchEntry <= CODEC.pDict->HiCode) return MatchEntry;
-
 				return LZWCODE(CODEC.pDict->HiCode + 1); 
 			}
 
+			//  hashSlot
+			//
+			//	This function will return the home slot in the string index for a (parent, value) key
+			//
+			//	PARAMETERS
+			//
+			//		uint32_t					-	The key (Parent << 8) | Value
+			//
+			//  RETURNS
+			//
+			//		size_t						-	The home slot for the key
+			//
+			//	NOTES
+			//
+			//		Fibonacci hashing, the index holds at most 4096 entries so the load never exceeds one half.
+			//
+
+			static size_t hashSlot(uint32_t Key) {
+				return size_t((Key * 2654435761u) >> (32 - LZW_HASH_BITS));
+			}
+
 			//  addToDictionary
 			//
 			//	This function will add a new code to the LZW dictionary.
@@ -987,6 +1089,14 @@ public:
 				//  Fill the code entry
 				CODEC.pDict->Entry[CODEC.pDict->HiCode].Parent = String;
 				CODEC.pDict->Entry[CODEC.pDict->HiCode].Value = BYTE(NextCode);
+
+				//  Index the new string
+				uint32_t		Key = (uint32_t(String) << 8) | BYTE(NextCode);			//  Key for the new string
+				size_t			Slot = hashSlot(Key);									//  Slot being probed
+
+				while (CODEC.pHash[Slot].Code != 0) Slot = (Slot + 1) & (LZW_HASH_SLOTS - 1);
+				CODEC.pHash[Slot].Key = Key;
+				CODEC.pHash[Slot].Code = CODEC.pDict->HiCode;
 				return;
 			}
 
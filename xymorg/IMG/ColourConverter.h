@@ -15,12 +15,16 @@
 //*																													*
 //*	NOTES:																											*
 //*																													*
+//*	1.	The row (span) conversion functions use SSE2 or AVX2 kernels when the build target and the executing CPU	*
+//*		support them, the kernel is selected once at runtime. All kernels produce results identical to the single	*
+//*		pixel conversion functions.																					*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
 //*   History:																										*
 //*																													*
 //*	1.0.0 - 04/08/2018   -  Initial version																			*
+//*	1.0.1 - 16/10/2026   -  Row conversion functions with SIMD kernels												*
 //*																													*
 //*******************************************************************************************************************
 
@@ -32,6 +36,28 @@
 //  Include xymorg image processing primitives
 #include	"types.h"																				//  Image processing primitive types
 
+//
+//  SIMD kernel availability
+//
+//  XY_CC_SSE2 is defined when the build target guarantees SSE2 (all x86-64 targets), XY_CC_AVX2 when the compiler
+//  is able to generate AVX2 code for individual functions. The AVX2 kernel is only used if the CPU supports it.
+//
+
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define		XY_CC_SSE2
+#include	<emmintrin.h>																			//  SSE2 intrinsics
+#if (defined(_MSC_VER) && (_MSC_VER >= 1800))
+#define		XY_CC_AVX2
+#define		XY_CC_AVX2_TARGET
+#include	<immintrin.h>																			//  AVX2 intrinsics
+#include	<intrin.h>																				//  __cpuid and _xgetbv
+#elif (defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9))))
+#define		XY_CC_AVX2
+#define		XY_CC_AVX2_TARGET	__attribute__((target("avx2")))
+#include	<immintrin.h>																			//  AVX2 intrinsics
+#endif
+#endif
+
 namespace xymorg {
 
 	//*******************************************************************************************************************
@@ -235,6 +261,258 @@ namespace xymorg {
 			return ycbcrOut;
 		}
 
+		//
+		//  Row (Span) Conversion Functions
+		//
+
+		//  convertRowToRGB   (YCbCr -->  RGB)
+		//
+		//  Converts a span of pixels encoded in YCbCr to RGB
+		//
+		//  PARAMETERS
+		//
+		//		YCbCr*		-		Const pointer to the first YCbCr encoded pixel of the span
+		//		RGB*		-		Pointer to the first RGB pixel of the output span
+		//		size_t		-		Number of pixels in the span
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//		1.		The results are identical to calling convertToRGB() for each pixel.
+		//
+
+		static void		convertRowToRGB(const YCbCr* pIn, RGB* pOut, size_t Count) {
+			BYTE			P0[CC_CHUNK] = {}, P1[CC_CHUNK] = {}, P2[CC_CHUNK] = {};		//  Planar Y, Cb, Cr (input)
+			BYTE			Q0[CC_CHUNK] = {}, Q1[CC_CHUNK] = {}, Q2[CC_CHUNK] = {};		//  Planar R, G, B (output)
+			int				Kernel = getKernel();											//  Selected kernel
+			size_t			Span = 0;														//  Pixels in the current chunk
+
+			//  Without a SIMD kernel convert pixel by pixel
+			if (Kernel == CC_KERNEL_SCALAR) {
+				for (size_t PX = 0; PX < Count; PX++) pOut[PX] = convertToRGB(pIn[PX]);
+				return;
+			}
+
+			//  Convert the span in chunks, splitting the channels into planes for the kernel
+			while (Count > 0) {
+				Span = Count;
+				if (Span > CC_CHUNK) Span = CC_CHUNK;
+				for (size_t PX = 0; PX < Span; PX++) {
+					P0[PX] = pIn[PX].Y;
+					P1[PX] = pIn[PX].Cb;
+					P2[PX] = pIn[PX].Cr;
+				}
+
+				rowToRGB(Kernel, P0, P1, P2, Q0, Q1, Q2, Span);
+
+				for (size_t PX = 0; PX < Span; PX++) {
+					pOut[PX].R = Q0[PX];
+					pOut[PX].G = Q1[PX];
+					pOut[PX].B = Q2[PX];
+				}
+
+				pIn += Span;
+				pOut += Span;
+				Count -= Span;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  convertRowToRGB   (planar YCbCr -->  RGB)
+		//
+		//  Converts a span of pixels held as separate Y, Cb and Cr sample rows to RGB
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*		-		Const pointer to the first Y sample of the span
+		//		BYTE*		-		Const pointer to the first Cb sample of the span
+		//		BYTE*		-		Const pointer to the first Cr sample of the span
+		//		RGB*		-		Pointer to the first RGB pixel of the output span
+		//		size_t		-		Number of pixels in the span
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//		1.		The kernel reads the sample rows in place, only a trailing partial step is staged.
+		//
+
+		static void		convertRowToRGB(const BYTE* pY, const BYTE* pCb, const BYTE* pCr, RGB* pOut, size_t Count) {
+			BYTE			P0[16] = {}, P1[16] = {}, P2[16] = {};							//  Staged tail (Y, Cb, Cr)
+			BYTE			Q0[CC_CHUNK] = {}, Q1[CC_CHUNK] = {}, Q2[CC_CHUNK] = {};		//  Planar R, G, B (output)
+			int				Kernel = getKernel();											//  Selected kernel
+			size_t			Span = 0;														//  Pixels in the current chunk
+			size_t			Whole = 0;														//  Pixels in complete kernel steps
+
+			//  Without a SIMD kernel convert pixel by pixel
+			if (Kernel == CC_KERNEL_SCALAR) {
+				for (size_t PX = 0; PX < Count; PX++) {
+					YCbCr	Pixel = { pY[PX], pCb[PX], pCr[PX] };
+
+					pOut[PX] = convertToRGB(Pixel);
+				}
+				return;
+			}
+
+			//  Convert the span in chunks
+			while (Count > 0) {
+				Span = Count;
+				if (Span > CC_CHUNK) Span = CC_CHUNK;
+				Whole = Span & ~size_t(15);
+
+				if (Whole > 0) rowToRGB(Kernel, pY, pCb, pCr, Q0, Q1, Q2, Whole);
+				if (Span > Whole) {
+					memcpy(P0, pY + Whole, Span - Whole);
+					memcpy(P1, pCb + Whole, Span - Whole);
+					memcpy(P2, pCr + Whole, Span - Whole);
+					rowToRGB(Kernel, P0, P1, P2, Q0 + Whole, Q1 + Whole, Q2 + Whole, 16);
+				}
+
+				for (size_t PX = 0; PX < Span; PX++) {
+					pOut[PX].R = Q0[PX];
+					pOut[PX].G = Q1[PX];
+					pOut[PX].B = Q2[PX];
+				}
+
+				pY += Span;
+				pCb += Span;
+				pCr += Span;
+				pOut += Span;
+				Count -= Span;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  convertRowToYCbCr   (RGB -->  YCbCr)
+		//
+		//  Converts a span of pixels encoded in RGB to YCbCr
+		//
+		//  PARAMETERS
+		//
+		//		RGB*		-		Const pointer to the first RGB encoded pixel of the span
+		//		YCbCr*		-		Pointer to the first YCbCr pixel of the output span
+		//		size_t		-		Number of pixels in the span
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//		1.		The results are identical to calling convertToYCbCr() for each pixel.
+		//
+
+		static void		convertRowToYCbCr(const RGB* pIn, YCbCr* pOut, size_t Count) {
+			BYTE			P0[CC_CHUNK] = {}, P1[CC_CHUNK] = {}, P2[CC_CHUNK] = {};		//  Planar R, G, B (input)
+			BYTE			Q0[CC_CHUNK] = {}, Q1[CC_CHUNK] = {}, Q2[CC_CHUNK] = {};		//  Planar Y, Cb, Cr (output)
+			int				Kernel = getKernel();											//  Selected kernel
+			size_t			Span = 0;														//  Pixels in the current chunk
+
+			//  Without a SIMD kernel convert pixel by pixel
+			if (Kernel == CC_KERNEL_SCALAR) {
+				for (size_t PX = 0; PX < Count; PX++) pOut[PX] = convertToYCbCr(pIn[PX]);
+				return;
+			}
+
+			//  Convert the span in chunks, splitting the channels into planes for the kernel
+			while (Count > 0) {
+				Span = Count;
+				if (Span > CC_CHUNK) Span = CC_CHUNK;
+				for (size_t PX = 0; PX < Span; PX++) {
+					P0[PX] = pIn[PX].R;
+					P1[PX] = pIn[PX].G;
+					P2[PX] = pIn[PX].B;
+				}
+
+				rowToYCbCr(Kernel, P0, P1, P2, Q0, Q1, Q2, Span);
+
+				for (size_t PX = 0; PX < Span; PX++) {
+					pOut[PX].Y = Q0[PX];
+					pOut[PX].Cb = Q1[PX];
+					pOut[PX].Cr = Q2[PX];
+				}
+
+				pIn += Span;
+				pOut += Span;
+				Count -= Span;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  convertRowToYCbCr   (RGB -->  planar YCbCr)
+		//
+		//  Converts a span of pixels encoded in RGB to separate Y, Cb and Cr sample rows
+		//
+		//  PARAMETERS
+		//
+		//		RGB*		-		Const pointer to the first RGB encoded pixel of the span
+		//		BYTE*		-		Pointer to the first Y sample of the output span
+		//		BYTE*		-		Pointer to the first Cb sample of the output span
+		//		BYTE*		-		Pointer to the first Cr sample of the output span
+		//		size_t		-		Number of pixels in the span
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//		1.		The kernel writes the sample rows in place, only a trailing partial step is staged.
+		//
+
+		static void		convertRowToYCbCr(const RGB* pIn, BYTE* pY, BYTE* pCb, BYTE* pCr, size_t Count) {
+			BYTE			P0[CC_CHUNK] = {}, P1[CC_CHUNK] = {}, P2[CC_CHUNK] = {};		//  Planar R, G, B (input)
+			BYTE			Q0[16] = {}, Q1[16] = {}, Q2[16] = {};							//  Staged tail (Y, Cb, Cr)
+			int				Kernel = getKernel();											//  Selected kernel
+			size_t			Span = 0;														//  Pixels in the current chunk
+			size_t			Whole = 0;														//  Pixels in complete kernel steps
+
+			//  Without a SIMD kernel convert pixel by pixel
+			if (Kernel == CC_KERNEL_SCALAR) {
+				for (size_t PX = 0; PX < Count; PX++) {
+					YCbCr	Pixel = convertToYCbCr(pIn[PX]);
+
+					pY[PX] = Pixel.Y;
+					pCb[PX] = Pixel.Cb;
+					pCr[PX] = Pixel.Cr;
+				}
+				return;
+			}
+
+			//  Convert the span in chunks, splitting the channels into planes for the kernel
+			while (Count > 0) {
+				Span = Count;
+				if (Span > CC_CHUNK) Span = CC_CHUNK;
+				Whole = Span & ~size_t(15);
+
+				for (size_t PX = 0; PX < Span; PX++) {
+					P0[PX] = pIn[PX].R;
+					P1[PX] = pIn[PX].G;
+					P2[PX] = pIn[PX].B;
+				}
+
+				if (Whole > 0) rowToYCbCr(Kernel, P0, P1, P2, pY, pCb, pCr, Whole);
+				if (Span > Whole) {
+					rowToYCbCr(Kernel, P0 + Whole, P1 + Whole, P2 + Whole, Q0, Q1, Q2, 16);
+					memcpy(pY + Whole, Q0, Span - Whole);
+					memcpy(pCb + Whole, Q1, Span - Whole);
+					memcpy(pCr + Whole, Q2, Span - Whole);
+				}
+
+				pIn += Span;
+				pY += Span;
+				pCb += Span;
+				pCr += Span;
+				Count -= Span;
+			}
+
+			//  Return to caller
+			return;
+		}
+
 		//
 		//  Reference Pixel Conversion Functions
 		//
@@ -349,5 +627,314 @@ namespace xymorg {
 			return rgbOut;
 		}
 
+	private:
+
+		//*******************************************************************************************************************
+		//*																													*
+		//*  Private Constants																								*
+		//*																													*
+		//*******************************************************************************************************************
+
+		static const size_t		CC_CHUNK = 128;															//  Pixels per kernel call (multiple of 16)
+
+		static const int		CC_KERNEL_SCALAR = 0;													//  Portable per-pixel conversion
+		static const int		CC_KERNEL_SSE2 = 1;														//  SSE2 (8 pixels per step)
+		static const int		CC_KERNEL_AVX2 = 2;														//  AVX2 (16 pixels per step)
+
+		//*******************************************************************************************************************
+		//*																													*
+		//*  Private Functions																								*
+		//*																													*
+		//*******************************************************************************************************************
+
+		//  getKernel
+		//
+		//  Returns the kernel to be used for row conversions, the CPU features are only probed on the first call
+		//
+		//  PARAMETERS
+		//
+		//  RETURNS
+		//
+		//		int			-		Selected kernel
+		//
+		//  NOTES
+		//
+
+		static int		getKernel() {
+			static const int	Kernel = detectKernel();											//  Selected kernel
+
+			return Kernel;
+		}
+
+		//  detectKernel
+		//
+		//  Determines the best kernel supported by both the build and the executing CPU
+		//
+		//  PARAMETERS
+		//
+		//  RETURNS
+		//
+		//		int			-		Selected kernel
+		//
+		//  NOTES
+		//
+		//		1.		On Windows AVX2 is only used if the OS has enabled the extended (YMM) register state.
+		//
+
+		static int		detectKernel() {
+#if (defined(XY_CC_AVX2) && defined(_MSC_VER))
+			int			CPUInfo[4] = {};															//  CPUID registers
+
+			__cpuid(CPUInfo, 0);
+			if (CPUInfo[0] >= 7) {
+				__cpuid(CPUInfo, 1);
+				if ((CPUInfo[2] & (1 << 27)) && (CPUInfo[2] & (1 << 28))) {
+					if ((_xgetbv(0) & 6) == 6) {
+						__cpuidex(CPUInfo, 7, 0);
+						if (CPUInfo[1] & (1 << 5)) return CC_KERNEL_AVX2;
+					}
+				}
+			}
+#elif (defined(XY_CC_AVX2))
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2")) return CC_KERNEL_AVX2;
+#endif
+#if (defined(XY_CC_SSE2))
+			return CC_KERNEL_SSE2;
+#else
+			return CC_KERNEL_SCALAR;
+#endif
+		}
+
+		//  rowToRGB
+		//
+		//  Converts planar YCbCr samples to planar RGB samples using the selected kernel
+		//
+		//  PARAMETERS
+		//
+		//		int			-		Kernel to use
+		//		BYTE*		-		Const pointer to the Y samples
+		//		BYTE*		-		Const pointer to the Cb samples
+		//		BYTE*		-		Const pointer to the Cr samples
+		//		BYTE*		-		Pointer to the R output samples
+		//		BYTE*		-		Pointer to the G output samples
+		//		BYTE*		-		Pointer to the B output samples
+		//		size_t		-		Number of samples
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//		1.		The planes must be at least Count rounded up to a multiple of 16 samples long.
+		//
+
+		static void		rowToRGB(int Kernel, const BYTE* pY, const BYTE* pCb, const BYTE* pCr, BYTE* pR, BYTE* pG, BYTE* pB, size_t Count) {
+
+			switch (Kernel) {
+#if (defined(XY_CC_AVX2))
+			case CC_KERNEL_AVX2:
+				rowToRGBAVX2(pY, pCb, pCr, pR, pG, pB, Count);
+				return;
+#endif
+#if (defined(XY_CC_SSE2))
+			case CC_KERNEL_SSE2:
+				rowToRGBSSE2(pY, pCb, pCr, pR, pG, pB, Count);
+				return;
+#endif
+			default:
+				break;
+			}
+
+			//  Portable fallback
+			for (size_t PX = 0; PX < Count; PX++) {
+				YCbCr	Pixel = { pY[PX], pCb[PX], pCr[PX] };
+				RGB		Out = convertToRGB(Pixel);
+
+				pR[PX] = Out.R;
+				pG[PX] = Out.G;
+				pB[PX] = Out.B;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  rowToYCbCr
+		//
+		//  Converts planar RGB samples to planar YCbCr samples using the selected kernel
+		//
+		//  PARAMETERS
+		//
+		//		int			-		Kernel to use
+		//		BYTE*		-		Const pointer to the R samples
+		//		BYTE*		-		Const pointer to the G samples
+		//		BYTE*		-		Const pointer to the B samples
+		//		BYTE*		-		Pointer to the Y output samples
+		//		BYTE*		-		Pointer to the Cb output samples
+		//		BYTE*		-		Pointer to the Cr output samples
+		//		size_t		-		Number of samples
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//		1.		The planes must be at least Count rounded up to a multiple of 16 samples long.
+		//
+
+		static void		rowToYCbCr(int Kernel, const BYTE* pR, const BYTE* pG, const BYTE* pB, BYTE* pY, BYTE* pCb, BYTE* pCr, size_t Count) {
+
+			switch (Kernel) {
+#if (defined(XY_CC_AVX2))
+			case CC_KERNEL_AVX2:
+				rowToYCbCrAVX2(pR, pG, pB, pY, pCb, pCr, Count);
+				return;
+#endif
+#if (defined(XY_CC_SSE2))
+			case CC_KERNEL_SSE2:
+				rowToYCbCrSSE2(pR, pG, pB, pY, pCb, pCr, Count);
+				return;
+#endif
+			default:
+				break;
+			}
+
+			//  Portable fallback
+			for (size_t PX = 0; PX < Count; PX++) {
+				RGB		Pixel = { pR[PX], pG[PX], pB[PX] };
+				YCbCr	Out = convertToYCbCr(Pixel);
+
+				pY[PX] = Out.Y;
+				pCb[PX] = Out.Cb;
+				pCr[PX] = Out.Cr;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+#if (defined(XY_CC_SSE2))
+
+		//
+		//  SSE2 Kernels
+		//
+		//  Samples are widened to 16 bit lanes, every product in the integer conversions fits in 16 bits. Each term is
+		//  divided by 128 with truncation towards zero (as the scalar code does) by biasing negative products by 127
+		//  before the arithmetic shift. Saturating packing back to bytes performs the 0..255 clamp.
+		//
+
+		//  Multiply by a coefficient and divide by 128 truncating towards zero
+		static __m128i	termSSE2(__m128i Val, short Coeff) {
+			__m128i		Prod = _mm_mullo_epi16(Val, _mm_set1_epi16(Coeff));
+
+			Prod = _mm_add_epi16(Prod, _mm_and_si128(_mm_srai_epi16(Prod, 15), _mm_set1_epi16(127)));
+			return _mm_srai_epi16(Prod, 7);
+		}
+
+		//  Load 8 samples widened to 16 bits
+		static __m128i	loadSSE2(const BYTE* pIn) {
+			return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) pIn), _mm_setzero_si128());
+		}
+
+		//  Store 8 16 bit values as clamped samples
+		static void		storeSSE2(BYTE* pOut, __m128i Val) {
+			_mm_storel_epi64((__m128i*) pOut, _mm_packus_epi16(Val, Val));
+			return;
+		}
+
+		static void		rowToRGBSSE2(const BYTE* pY, const BYTE* pCb, const BYTE* pCr, BYTE* pR, BYTE* pG, BYTE* pB, size_t Count) {
+			const __m128i	Bias = _mm_set1_epi16(128);
+
+			for (size_t PX = 0; PX < Count; PX += 8) {
+				__m128i		Y = loadSSE2(pY + PX);
+				__m128i		Cb = _mm_sub_epi16(loadSSE2(pCb + PX), Bias);
+				__m128i		Cr = _mm_sub_epi16(loadSSE2(pCr + PX), Bias);
+
+				storeSSE2(pR + PX, _mm_add_epi16(Y, termSSE2(Cr, 180)));
+				storeSSE2(pG + PX, _mm_add_epi16(_mm_add_epi16(Y, termSSE2(Cb, -43)), termSSE2(Cr, -92)));
+				storeSSE2(pB + PX, _mm_add_epi16(Y, termSSE2(Cb, 226)));
+			}
+
+			return;
+		}
+
+		static void		rowToYCbCrSSE2(const BYTE* pR, const BYTE* pG, const BYTE* pB, BYTE* pY, BYTE* pCb, BYTE* pCr, size_t Count) {
+			const __m128i	Bias = _mm_set1_epi16(128);
+
+			for (size_t PX = 0; PX < Count; PX += 8) {
+				__m128i		R = loadSSE2(pR + PX);
+				__m128i		G = loadSSE2(pG + PX);
+				__m128i		B = loadSSE2(pB + PX);
+
+				storeSSE2(pY + PX, _mm_add_epi16(_mm_add_epi16(termSSE2(R, 38), termSSE2(G, 75)), termSSE2(B, 15)));
+				storeSSE2(pCb + PX, _mm_add_epi16(_mm_add_epi16(_mm_add_epi16(termSSE2(R, -22), termSSE2(G, -43)), termSSE2(B, 64)), Bias));
+				storeSSE2(pCr + PX, _mm_add_epi16(_mm_add_epi16(_mm_add_epi16(termSSE2(R, 64), termSSE2(G, -54)), termSSE2(B, -10)), Bias));
+			}
+
+			return;
+		}
+
+#endif
+
+#if (defined(XY_CC_AVX2))
+
+		//
+		//  AVX2 Kernels
+		//
+		//  As the SSE2 kernels but 16 samples per step.
+		//
+
+		//  Multiply by a coefficient and divide by 128 truncating towards zero
+		XY_CC_AVX2_TARGET static __m256i	termAVX2(__m256i Val, short Coeff) {
+			__m256i		Prod = _mm256_mullo_epi16(Val, _mm256_set1_epi16(Coeff));
+
+			Prod = _mm256_add_epi16(Prod, _mm256_and_si256(_mm256_srai_epi16(Prod, 15), _mm256_set1_epi16(127)));
+			return _mm256_srai_epi16(Prod, 7);
+		}
+
+		//  Load 16 samples widened to 16 bits
+		XY_CC_AVX2_TARGET static __m256i	loadAVX2(const BYTE* pIn) {
+			return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) pIn));
+		}
+
+		//  Store 16 16 bit values as clamped samples
+		XY_CC_AVX2_TARGET static void		storeAVX2(BYTE* pOut, __m256i Val) {
+			_mm_storeu_si128((__m128i*) pOut, _mm_packus_epi16(_mm256_castsi256_si128(Val), _mm256_extracti128_si256(Val, 1)));
+			return;
+		}
+
+		XY_CC_AVX2_TARGET static void		rowToRGBAVX2(const BYTE* pY, const BYTE* pCb, const BYTE* pCr, BYTE* pR, BYTE* pG, BYTE* pB, size_t Count) {
+			const __m256i	Bias = _mm256_set1_epi16(128);
+
+			for (size_t PX = 0; PX < Count; PX += 16) {
+				__m256i		Y = loadAVX2(pY + PX);
+				__m256i		Cb = _mm256_sub_epi16(loadAVX2(pCb + PX), Bias);
+				__m256i		Cr = _mm256_sub_epi16(loadAVX2(pCr + PX), Bias);
+
+				storeAVX2(pR + PX, _mm256_add_epi16(Y, termAVX2(Cr, 180)));
+				storeAVX2(pG + PX, _mm256_add_epi16(_mm256_add_epi16(Y, termAVX2(Cb, -43)), termAVX2(Cr, -92)));
+				storeAVX2(pB + PX, _mm256_add_epi16(Y, termAVX2(Cb, 226)));
+			}
+
+			return;
+		}
+
+		XY_CC_AVX2_TARGET static void		rowToYCbCrAVX2(const BYTE* pR, const BYTE* pG, const BYTE* pB, BYTE* pY, BYTE* pCb, BYTE* pCr, size_t Count) {
+			const __m256i	Bias = _mm256_set1_epi16(128);
+
+			for (size_t PX = 0; PX < Count; PX += 16) {
+				__m256i		R = loadAVX2(pR + PX);
+				__m256i		G = loadAVX2(pG + PX);
+				__m256i		B = loadAVX2(pB + PX);
+
+				storeAVX2(pY + PX, _mm256_add_epi16(_mm256_add_epi16(termAVX2(R, 38), termAVX2(G, 75)), termAVX2(B, 15)));
+				storeAVX2(pCb + PX, _mm256_add_epi16(_mm256_add_epi16(_mm256_add_epi16(termAVX2(R, -22), termAVX2(G, -43)), termAVX2(B, 64)), Bias));
+				storeAVX2(pCr + PX, _mm256_add_epi16(_mm256_add_epi16(_mm256_add_epi16(termAVX2(R, 64), termAVX2(G, -54)), termAVX2(B, -10)), Bias));
+			}
+
+			return;
+		}
+
+#endif
+
 	};
 }
@@ -16,12 +16,16 @@
 //*																													*
 //*	NOTES:																											*
 //*																													*
+//*	1.	Colours are located through an open addressing (linear probe) hash index that is maintained alongside the	*
+//*		colour table array. Removing an entry moves the last entry of the array into the vacated position.			*
+//*	2.	The colour table array is grown by doubling.																*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
 //*   History:																										*
 //*																													*
 //*	1.0.0 - 04/08/2018   -  Initial version																			*
+//*	1.0.1 - 16/10/2026   -  Hashed colour index																		*
 //*																													*
 //*******************************************************************************************************************
 
@@ -71,11 +75,20 @@ namespace xymorg {
 			//  Allocate the colour table array for 256 colours
 			NumColours = 0;
 			AllocColours = 0;
+			IndexSlots = 0;
+			IndexGen = 1;
+			pIndex = nullptr;
 			pCT = (CTE*) malloc(256 * sizeof(CTE));
 			if (pCT == nullptr) return;
 			memset(pCT, 0, 256 * sizeof(CTE));
 			AllocColours = 256;
 
+			//  Allocate the hash index
+			pIndex = (CTX*) malloc(CT_INITIAL_SLOTS * sizeof(CTX));
+			if (pIndex == nullptr) return;
+			memset(pIndex, 0, CT_INITIAL_SLOTS * sizeof(CTX));
+			IndexSlots = CT_INITIAL_SLOTS;
+
 			//  Return to caller
 			return;
 		}
@@ -100,6 +113,9 @@ namespace xymorg {
 		~ColourTable() {
 			//  Free the internal colour table (if allocated)
 			if (pCT != nullptr) free(pCT);
+
+			//  Free the hash index (if allocated)
+			if (pIndex != nullptr) free(pIndex);
 			
 			//  Return to caller
 			return;
@@ -122,7 +138,7 @@ namespace xymorg {
 		//
 
 		size_t			getNumColours() { return NumColours; }
-		void			clear() { NumColours = 0; return; }
+		void			clear() { clearIndex(); NumColours = 0; return; }
 
 		//
 		//  Colour Table Accessors
@@ -307,12 +323,13 @@ namespace xymorg {
 			//
 
 			if (NumColours == AllocColours) {
-				//  Table must be expanded
-				CTE* pNewCT = (CTE*) realloc(pCT, (AllocColours + 256) * sizeof(CTE));
+				//  Table must be expanded, doubling the allocation
+				size_t	NewAlloc = (AllocColours == 0) ? 256 : AllocColours * 2;			//  New allocation
+				CTE* pNewCT = (CTE*) realloc(pCT, NewAlloc * sizeof(CTE));
 				if (pNewCT == nullptr) return;
 				pCT = pNewCT;
-				memset(&pCT[AllocColours], 0, 256 * sizeof(CTE));
-				AllocColours += 256;
+				memset(&pCT[AllocColours], 0, (NewAlloc - AllocColours) * sizeof(CTE));
+				AllocColours = NewAlloc;
 			}
 
 			//  Add the new entry to the table
@@ -325,6 +342,9 @@ namespace xymorg {
 			pCT[NumColours].Extents.Right = 0;
 			NumColours++;
 
+			//  Index the new entry
+			indexColour(NumColours - 1);
+
 			return;
 		}
 
@@ -366,12 +386,13 @@ namespace xymorg {
 			//
 
 			if (NumColours == AllocColours) {
-				//  Table must be expanded
-				CTE* pNewCT = (CTE*) realloc(pCT, (AllocColours + 256) * sizeof(CTE));
+				//  Table must be expanded, doubling the allocation
+				size_t	NewAlloc = (AllocColours == 0) ? 256 : AllocColours * 2;			//  New allocation
+				CTE* pNewCT = (CTE*) realloc(pCT, NewAlloc * sizeof(CTE));
 				if (pNewCT == nullptr) return;
 				pCT = pNewCT;
-				memset(&pCT[AllocColours], 0, 256 * sizeof(CTE));
-				AllocColours += 256;
+				memset(&pCT[AllocColours], 0, (NewAlloc - AllocColours) * sizeof(CTE));
+				AllocColours = NewAlloc;
 			}
 
 			//  Add the new entry to the table
@@ -384,6 +405,9 @@ namespace xymorg {
 			pCT[NumColours].Extents.Right = Col;
 			NumColours++;
 
+			//  Index the new entry
+			indexColour(NumColours - 1);
+
 			return;
 		}
 
@@ -399,14 +423,20 @@ namespace xymorg {
 		//
 		//  NOTES
 		//
+		//  The last entry in the table is moved into the vacated position, the order of the other entries is unchanged.
+		//
 
 		void		remove(size_t CX) {
 
 			if (CX >= NumColours) return;
 
-			//  Shuffle up the table
+			//  Remove the entry from the index
+			unindexColour(CX);
+
+			//  Move the last entry into the vacated position and re-point the index at it
 			if (CX < (NumColours - 1)) {
-				memmove(&pCT[CX], &pCT[CX + 1], (NumColours - (CX + 1)) * sizeof(CTE));
+				pCT[CX] = pCT[NumColours - 1];
+				pIndex[findSlot(packColour(pCT[CX].Colour))].Entry = uint32_t(CX + 1);
 			}
 
 			//  Clear the last entry
@@ -455,16 +485,23 @@ namespace xymorg {
 		//
 
 		void		removeAll(const BoundingBox& Extents) {
-			size_t		CX = 0;																		//  Iterator
+			size_t		Kept = 0;																	//  Count of entries kept
 
-			//  Iterate over the colour table removing qualifying colour entries
-			while (CX < NumColours) {
+			//  Iterate over the colour table compacting the entries that do not qualify for removal
+			clearIndex();
+			for (size_t CX = 0; CX < NumColours; CX++) {
 				if (pCT[CX].Extents.Top >= Extents.Top &&
 					pCT[CX].Extents.Bottom <= Extents.Bottom &&
 					pCT[CX].Extents.Left >= Extents.Left &&
-					pCT[CX].Extents.Right <= Extents.Right) remove(CX);
-				else CX++;
+					pCT[CX].Extents.Right <= Extents.Right) continue;
+				if (Kept < CX) pCT[Kept] = pCT[CX];
+				Kept++;
+				indexColour(Kept - 1);
 			}
+
+			//  Clear the vacated entries
+			if (Kept < NumColours) memset(&pCT[Kept], 0, (NumColours - Kept) * sizeof(CTE));
+			NumColours = Kept;
 			
 			//  Return to caller
 			return;
@@ -483,6 +520,8 @@ namespace xymorg {
 		//
 		//  NOTES
 		//
+		//  The source entry is removed, if the target was the last entry in the table it is moved to the source index.
+		//
 
 		void		combine(size_t SC, size_t TC) {
 
@@ -572,6 +611,7 @@ namespace xymorg {
 
 		void		reset() {
 
+			clearIndex();
 			NumColours = 0;
 			memset(pCT, 0, AllocColours * sizeof(C));
 
@@ -617,19 +657,10 @@ namespace xymorg {
 		//
 
 		bool		contains(ColourTable<C>& Candidate) {
-			bool		HasColour = false;
 
 			//  Iterate each colour in the Candidate table
 			for (size_t CCX = 0; CCX < Candidate.getNumColours(); CCX++) {
-				HasColour = false;
-				for (size_t CX = 0; CX < NumColours; CX++) {
-					if (Candidate.getColour(CCX) == pCT[CX].Colour) {
-						HasColour = true;
-						break;
-					}
-				}
-
-				if (!HasColour) return false;
+				if (!hasColour(Candidate.getColour(CCX))) return false;
 			}
 
 			//  Return showing success (Candidate is contained in the current table)
@@ -698,6 +729,18 @@ namespace xymorg {
 		//*																													*
 		//*******************************************************************************************************************
 
+		static const size_t		CT_INITIAL_SLOTS = 1024;									//  Initial hash index slots (power of 2)
+
+		struct CTX {
+			uint32_t	Key;																//  Packed colour
+			uint32_t	Entry;																//  Colour table index + 1
+			uint32_t	Gen;																//  Generation in which the slot was filled
+		};
+
+		size_t			IndexSlots;															//  Number of slots in the hash index
+		uint32_t		IndexGen;															//  Current index generation
+		CTX*			pIndex;																//  Hash index
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Private Functions                                                                                             *
@@ -721,6 +764,7 @@ namespace xymorg {
 		//
 
 		CTE* findColour(const C& FCol, size_t& CX) {
+			size_t		Slot = 0;																	//  Index slot
 
 			//  Boundary - Colour table is empty
 			if (NumColours == 0) {
@@ -728,13 +772,216 @@ namespace xymorg {
 				return nullptr;
 			}
 
-			//  Search the colour table
-			for (CX = 0; CX < NumColours; CX++) {
-				if (pCT[CX].Colour == FCol) return &pCT[CX];
+			//  Search the index
+			Slot = findSlot(packColour(FCol));
+			if (pIndex[Slot].Gen != IndexGen) {
+				CX = NumColours;
+				return nullptr;
+			}
+
+			CX = size_t(pIndex[Slot].Entry) - 1;
+			return &pCT[CX];
+		}
+
+		//  packColour
+		//
+		//  Returns the index key for the passed colour
+		//
+		//  PARAMETERS
+		//
+		//		C&			-		Const reference to the colour
+		//
+		//  RETURNS
+		//
+		//		uint32_t	-		Colour channels packed into a 32 bit key
+		//
+		//  NOTES
+		//
+
+		static uint32_t		packColour(const C& Colour) {
+			uint32_t		Key = 0;																//  Packed colour key
+
+			static_assert(sizeof(C) <= sizeof(uint32_t), "ColourTable colour types must pack into 32 bits");
+			memcpy(&Key, &Colour, sizeof(C));
+			return Key;
+		}
+
+		//  homeSlot
+		//
+		//  Returns the home slot in the hash index for the passed key
+		//
+		//  PARAMETERS
+		//
+		//		uint32_t	-		Packed colour key
+		//
+		//  RETURNS
+		//
+		//		size_t		-		Home slot for the key
+		//
+		//  NOTES
+		//
+		//  The key is spread with a multiplicative (Fibonacci) hash.
+		//
+
+		size_t		homeSlot(uint32_t Key) {
+			return size_t((uint64_t(Key) * 0x9E3779B97F4A7C15ull) >> 32) & (IndexSlots - 1);
+		}
+
+		//  findSlot
+		//
+		//  Returns the slot in the hash index that holds the passed key, or the free slot that ends the probe
+		//
+		//  PARAMETERS
+		//
+		//		uint32_t	-		Packed colour key
+		//
+		//  RETURNS
+		//
+		//		size_t		-		Slot for the key
+		//
+		//  NOTES
+		//
+		//  A slot is free if it was not filled in the current generation.
+		//
+
+		size_t		findSlot(uint32_t Key) {
+			size_t		Slot = homeSlot(Key);														//  Index slot
+
+			while (pIndex[Slot].Gen == IndexGen) {
+				if (pIndex[Slot].Key == Key) return Slot;
+				Slot = (Slot + 1) & (IndexSlots - 1);
 			}
 
 			//  Not Found
-			return nullptr;
+			return Slot;
+		}
+
+		//  indexColour
+		//
+		//  Adds the colour table entry at the passed index to the hash index
+		//
+		//  PARAMETERS
+		//
+		//		size_t		-		Index of the colour table entry
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  The index is doubled in size (and rebuilt) when it becomes half full.
+		//
+
+		void		indexColour(size_t CX) {
+			uint32_t		Key = packColour(pCT[CX].Colour);										//  Key of the new entry
+			size_t			Slot = 0;																//  Index slot
+
+			if ((NumColours * 2) > IndexSlots) {
+				CTX*		pOldIndex = pIndex;														//  Previous index
+				size_t		OldSlots = IndexSlots;													//  Previous index size
+
+				pIndex = (CTX*) malloc(OldSlots * 2 * sizeof(CTX));
+				if (pIndex == nullptr) {
+					pIndex = pOldIndex;
+					return;
+				}
+				memset(pIndex, 0, OldSlots * 2 * sizeof(CTX));
+				IndexSlots = OldSlots * 2;
+
+				//  Re-hash the live slots of the previous index
+				for (size_t IX = 0; IX < OldSlots; IX++) {
+					if (pOldIndex[IX].Gen == IndexGen) pIndex[findSlot(pOldIndex[IX].Key)] = pOldIndex[IX];
+				}
+				free(pOldIndex);
+			}
+
+			Slot = findSlot(Key);
+			pIndex[Slot].Key = Key;
+			pIndex[Slot].Entry = uint32_t(CX + 1);
+			pIndex[Slot].Gen = IndexGen;
+
+			//  Return to caller
+			return;
+		}
+
+		//  unindexColour
+		//
+		//  Removes the colour table entry at the passed index from the hash index
+		//
+		//  PARAMETERS
+		//
+		//		size_t		-		Index of the colour table entry
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  Deletion shifts following entries of the probe sequence back so that no tombstones are needed.
+		//
+
+		void		unindexColour(size_t CX) {
+			size_t		Hole = findSlot(packColour(pCT[CX].Colour));								//  Slot being emptied
+			size_t		Slot = Hole;																//  Probe slot
+			size_t		Home = 0;																	//  Home slot of the probed entry
+
+			if (pIndex[Hole].Gen != IndexGen) return;
+
+			for (;;) {
+				Slot = (Slot + 1) & (IndexSlots - 1);
+				if (pIndex[Slot].Gen != IndexGen) break;
+
+				//  The entry may fill the hole if its home slot is not cyclically within (Hole, Slot]
+				Home = homeSlot(pIndex[Slot].Key);
+				if (((Slot - Home) & (IndexSlots - 1)) >= ((Slot - Hole) & (IndexSlots - 1))) {
+					pIndex[Hole] = pIndex[Slot];
+					Hole = Slot;
+				}
+			}
+
+			pIndex[Hole].Gen = 0;
+
+			//  Return to caller
+			return;
+		}
+
+		//  clearIndex
+		//
+		//  Empties the hash index
+		//
+		//  PARAMETERS
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  Moving to a new generation frees every slot without touching the index, the index is only cleared when the
+		//  generation number wraps.
+		//
+
+		void		clearIndex() {
+			size_t		Slots = CT_INITIAL_SLOTS;													//  Slots needed
+
+			//  An index that is much larger than the table is shrunk to keep it compact in the cache
+			while (Slots < (NumColours * 4)) Slots = Slots * 2;
+			if (Slots < (IndexSlots / 4)) {
+				CTX*	pNewIndex = (CTX*) malloc(Slots * sizeof(CTX));
+				if (pNewIndex != nullptr) {
+					free(pIndex);
+					pIndex = pNewIndex;
+					IndexSlots = Slots;
+					memset(pIndex, 0, IndexSlots * sizeof(CTX));
+					IndexGen = 1;
+					return;
+				}
+			}
+
+			IndexGen++;
+			if (IndexGen == 0) {
+				if (pIndex != nullptr) memset(pIndex, 0, IndexSlots * sizeof(CTX));
+				IndexGen = 1;
+			}
+
+			//  Return to caller
+			return;
 		}
 
 		//  setDisplayChars
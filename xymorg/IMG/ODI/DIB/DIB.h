@@ -124,23 +124,22 @@ namespace xymorg {
 		//
 
 		static Train<RGB>* loadImageRGB(const char* ImgName, VRMapper& VRMap) {
-			BYTE*			pImage = nullptr;													//  Pointer to the in-memory image
-			size_t			ImgSize = 0;														//  Image Size
+			ResourceView	Image;																//  View of the on-disk image
 			Train<RGB>*		pTrain = nullptr;													//  Constructed Train	
 
 			//  Safety
 			if (ImgName == nullptr) return nullptr;
 			if (ImgName[0] == '\0') return nullptr;
 
-			//  Load the on-disk image into memory
-			pImage = VRMap.loadResource(ImgName, ImgSize);
-			if (pImage == nullptr) return nullptr;
+			//  Map the on-disk image into memory
+			Image = VRMap.mapResource(ImgName);
+			if (!Image.isValid()) return nullptr;
 
 			//  Unbutton the image to a train
-			pTrain = unbuttonImage(pImage, ImgSize);
+			pTrain = unbuttonImage(Image);
 
-			//  Free the image
-			free(pImage);
+			//  Release the image view
+			VRMap.unmapResource(Image);
 
 			//  Return the train
 			return pTrain;
@@ -191,6 +190,34 @@ namespace xymorg {
 			return storeRGBImage(ImgName, VRMap, pTrain, Opts);
 		}
 
+		//  storeImage
+		//
+		//  This static function will store the passed RGB Train as a DIB (BMP) image written to the passed sink
+		//
+		//  PARAMETERS
+		//
+		//		ResourceSink&	-		Reference to the sink that receives the image
+		//		Train*			-		Pointer to the Train to store
+		//		SWITCHES		-		Options to use for storing images
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the complete image was written to the sink, otherwise false
+		//
+		//  NOTES
+		//
+		//		1.		The caller owns the sink, a ResourceWriter must still be closed to complete the image file.
+		//
+
+		static bool		storeImage(ResourceSink& Image, Train<RGB>* pTrain, SWITCHES Opts) {
+
+			//  Safety
+			if (pTrain == nullptr) return false;
+			if (pTrain->getCanvasHeight() == 0 || pTrain->getCanvasWidth() == 0) return false;
+
+			return buttonImage(Image, pTrain, Opts);
+		}
+
 		//  storeRGBImage
 		//
 		//  This static function will store the passed RGB Train into the designated DIB (BMP) Image file
@@ -210,8 +237,7 @@ namespace xymorg {
 		//
 
 		static bool		storeRGBImage(const char* ImgName, VRMapper& VRMap, Train<RGB>* pTrain, SWITCHES Opts) {
-			BYTE*		pImage = nullptr;												//  Pointer to the in-memory image
-			size_t		ImgSize = 0;													//  Size of the in-memory image
+			ResourceWriter	Image;														//  Writer for the on-disk image
 
 			//  Safety
 			if (ImgName == nullptr) return false;
@@ -221,17 +247,18 @@ namespace xymorg {
 
 			//  Set the default options when needed
 
-			//  Build the in-memory image of the DIB On-Disk image
-			pImage = buttonImage(ImgSize, pTrain, Opts);
-			if (pImage == nullptr || ImgSize == 0) {
-				std::cerr << "ERROR: Unable to build an DIB/BMP on-disk image for: " << ImgName << "." << std::endl;
-				if (pImage != nullptr) free(pImage);
+			//  Open the on-disk image for streamed output
+			Image = VRMap.openResourceWriter(ImgName);
+			if (!Image.isOpen()) {
+				std::cerr << "ERROR: Failed to open DIB/BMP image: '" << ImgName << "' for output." << std::endl;
 				return false;
 			}
 
-			//  Store the in-memory image  (consumes the image memory allocation)
-			if (!VRMap.storeResource(ImgName, pImage, ImgSize)) {
-				std::cerr << "ERROR: Failed to store DIB/BMP image: '" << ImgName << "', (" << ImgSize << " bytes)." << std::endl;
+			//  Button the image into the on-disk image
+			if (!buttonImage(Image, pTrain, Opts) || !Image.close()) {
+				std::cerr << "ERROR: Failed to store DIB/BMP image: '" << ImgName << "', (" << Image.getBytesWritten() << " bytes written)." << std::endl;
+				Image.close();
+				VRMap.deleteResource(ImgName);
 				return false;
 			}
 
@@ -422,6 +449,63 @@ namespace xymorg {
 			return pImage;
 		}
 
+		//  buttonImage
+		//
+		//  This static function button up the passed train into a DIB image written to the passed sink
+		//
+		//  PARAMETERS
+		//
+		//		ResourceSink&	-		Reference to the sink that receives the image
+		//		Train*			-		Pointer to the image Train to be buttoned
+		//		SWIRCHES		-		Options for storing the image
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the complete image was written to the sink, otherwise false
+		//
+		//  NOTES
+		//
+		//		The headers are fixed up once the bitmap has been encoded (the RLE encodings may revert to RGB), so
+		//		the image is built in memory and then written to the sink.
+		//
+
+		static bool buttonImage(ResourceSink& Image, Train<RGB>* pTrain, SWITCHES Opts) {
+			BYTE*			pImage = nullptr;											//  In-Memory image
+			size_t			ImgSize = 0;												//  Size of the in-memory image
+
+			pImage = buttonImage(ImgSize, pTrain, Opts);
+			if (pImage == nullptr || ImgSize == 0) {
+				if (pImage != nullptr) free(pImage);
+				return false;
+			}
+
+			Image.write(pImage, ImgSize);
+			free(pImage);
+			return !Image.hasFailed();
+		}
+
+		//  unbuttonImage
+		//
+		//  This static function will unbutton the content of a read-only view of an image to an RGB train.
+		//
+		//  PARAMETERS
+		//
+		//		ResourceView&	-		Const reference to the view of the image to be unbuttoned to a Train
+		//
+		//  RETURNS
+		//
+		//		Train*			-		Pointer to the image Train, NULL if it could not be unbuttoned
+		//
+		//  NOTES
+		//
+		//		1.		Unbuttoning never writes to the in-memory image, so the view may be a read-only mapping.
+		//
+
+		static Train<RGB>* unbuttonImage(const ResourceView& Image) {
+			if (!Image.isValid()) return nullptr;
+			return unbuttonImage(const_cast<BYTE*>(Image.getData()), Image.getSize());
+		}
+
 		//  unbuttonImage
 		//
 		//  This static function will map the in-memory image and unbutton the content to an RGB train.
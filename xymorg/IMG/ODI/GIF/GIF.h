@@ -42,6 +42,7 @@
 
 //  Include GIF specific components
 #include	"../../CODECS/LZW.h"																	//  Lempel-Ziv-Walsh CODEC
+#include	"../../../MP/WorkGang.h"																//  Worker gang
 
 namespace xymorg {
 
@@ -125,23 +126,22 @@ namespace xymorg {
 		//
 
 		static Train<RGB>* loadImageRGB(const char* ImgName, VRMapper& VRMap) {
-			BYTE*			pImage = nullptr;													//  Pointer to the in-memory image
-			size_t			ImgSize = 0;														//  Image Size
+			ResourceView	Image;																//  View of the on-disk image
 			Train<RGB>*		pTrain = nullptr;													//  Constructed Train	
 
 			//  Safety
 			if (ImgName == nullptr) return nullptr;
 			if (ImgName[0] == '\0') return nullptr;
 
-			//  Load the on-disk image into memory
-			pImage = VRMap.loadResource(ImgName, ImgSize);
-			if (pImage == nullptr) return nullptr;
+			//  Map the on-disk image into memory
+			Image = VRMap.mapResource(ImgName);
+			if (!Image.isValid()) return nullptr;
 
 			//  Unzip the image to a train
-			pTrain = unbuttonImage(pImage, ImgSize);
+			pTrain = unbuttonImage(Image);
 
-			//  Free the image
-			free(pImage);
+			//  Release the image view
+			VRMap.unmapResource(Image);
 
 			//  Return the train
 			return pTrain;
@@ -211,8 +211,7 @@ namespace xymorg {
 		//
 
 		static bool		storeImageRGB(const char* ImgName, VRMapper& VRMap, Train<RGB>* pTrain, SWITCHES Opts) {
-			BYTE*		pImage = nullptr;												//  Pointer to the in-memory image
-			size_t		ImgSize = 0;													//  Size of the in-memory image
+			ResourceWriter	Image;														//  Writer for the on-disk image
 
 			//  Safety
 			if (ImgName == nullptr) return false;
@@ -224,17 +223,18 @@ namespace xymorg {
 			//  If the animation setting ONCE is not asserted then enforce PERPETUAL
 			if (!(Opts & GIF_ANIMATE_OPT_ONCE)) Opts = Opts | GIF_ANIMATE_OPT_PERPETUAL;
 
-			//  Build the in-memory image of the GIF On-Disk image
-			pImage = buttonImage(ImgSize, pTrain, Opts);
-			if (pImage == nullptr || ImgSize == 0) {
-				std::cerr << "ERROR: Unable to build an GIF on-disk image for: " << ImgName << "." << std::endl;
-				if (pImage != nullptr) free(pImage);
+			//  Open the on-disk image for streamed output
+			Image = VRMap.openResourceWriter(ImgName);
+			if (!Image.isOpen()) {
+				std::cerr << "ERROR: Failed to open GIF image: '" << ImgName << "' for output." << std::endl;
 				return false;
 			}
 
-			//  Store the in-memory image  (consu,es the image)
-			if (!VRMap.storeResource(ImgName, pImage, ImgSize)) {
-				std::cerr << "ERROR: Failed to store GIF image: '" << ImgName << "', (" << ImgSize << " bytes)." << std::endl;
+			//  Button the image straight into the on-disk image
+			if (!buttonImage(Image, pTrain, Opts) || !Image.close()) {
+				std::cerr << "ERROR: Failed to store GIF image: '" << ImgName << "', (" << Image.getBytesWritten() << " bytes written)." << std::endl;
+				Image.close();
+				VRMap.deleteResource(ImgName);
 				return false;
 			}
 
@@ -407,6 +407,7 @@ namespace xymorg {
 			size_t		Pixels;																		//  Number of pixels in the partition
 			size_t		Colours;																	//  Number of colours wholly contained
 			double		Score;																		//  Score for the partition
+			BoundingBox	Extents;																	//  Extents of the partition colour
 
 			PTE() {
 				H = 0;
@@ -414,10 +415,35 @@ namespace xymorg {
 				Pixels = 0;
 				Colours = 0;
 				Score = 0.0;
+				Extents = {};
 				return;
 			}
 		} PTE;
 
+		//  Animation frame optimisation plan
+		typedef struct FOPLAN {
+		public:
+			bool				Planned;															//  The plan has been made
+			int					Action;																//  Action to take (FOPLAN_xxx)
+			BoundingBox			bbDiff;																//  Bounds of the difference region
+			RasterBuffer<RGB>*	pTile;																//  Difference region tile (FOPLAN_TILE)
+			Frame<RGB>*			pFrags;																//  Mini-train of fragments (FOPLAN_FRAGMENT)
+
+			FOPLAN() {
+				Planned = false;
+				Action = 0;
+				bbDiff = {};
+				pTile = nullptr;
+				pFrags = nullptr;
+				return;
+			}
+		} FOPLAN;
+
+		static const int		FOPLAN_DELETE = 1;													//  Frame matches the reference - delete it
+		static const int		FOPLAN_TILE = 2;													//  Replace the frame with the difference region
+		static const int		FOPLAN_FRAGMENT = 3;												//  Replace the frame with fragments
+		static const int		FOPLAN_ASIS = 4;													//  Use the frame as-is
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Private Functions                                                                                             *
@@ -426,7 +452,7 @@ namespace xymorg {
 
 		//  buttonImage
 		//
-		//  This static function button up the passed train into an on-disk GIF image format
+		//  This static function button up the passed train into an in-memory GIF image
 		//
 		//  PARAMETERS
 		//
@@ -442,8 +468,32 @@ namespace xymorg {
 		//
 
 		static BYTE* buttonImage(size_t& ImgSize, Train<RGB>* pTrain, SWITCHES Opts) {
-			BYTE*			pImage = nullptr;											//  In-Memory image
-			size_t			NewImgSize = 0;												//  Size of the in-memory image
+			ResourceBuffer	Image;														//  In-Memory image
+
+			ImgSize = 0;
+			if (!buttonImage(Image, pTrain, Opts)) return nullptr;
+			return Image.acquireBuffer(ImgSize);
+		}
+
+		//  buttonImage
+		//
+		//  This static function button up the passed train into a GIF image written to the passed sink
+		//
+		//  PARAMETERS
+		//
+		//		ResourceSink&	-		Reference to the sink that receives the image
+		//		Train*			-		Pointer to the image Train to be buttoned
+		//		SWIRCHES		-		Options for storing the image
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the complete image was written to the sink, otherwise false
+		//
+		//  NOTES
+		//
+
+		static bool buttonImage(ResourceSink& Image, Train<RGB>* pTrain, SWITCHES Opts) {
+			bool			Written = false;											//  Image written
 			Train<RGB>*		pCTrain = nullptr;											//  Canonical Train (Writeable)
 
 			//  Auto adjust the Train Canvas Size
@@ -451,17 +501,38 @@ namespace xymorg {
 
 			//  Construct the Canonical Train from the input train. The Canonical Train is directly writeble as a GIF image.
 			pCTrain = buildCanonicalTrain(pTrain, Opts);
-			if (pCTrain == nullptr) return nullptr;
+			if (pCTrain == nullptr) return false;
 
-			//  Serialise the Canonical Train into a memory image
-			pImage = serialiseTrain(pCTrain, NewImgSize, Opts);
+			//  Serialise the Canonical Train into the sink
+			Written = serialiseTrain(pCTrain, Image, Opts);
 
 			//  Delete the Canonical Train
 			delete pCTrain;
 
-			//  Return the constructed image
-			ImgSize = NewImgSize;
-			return pImage;
+			//  Return showing if the image was written
+			return Written;
+		}
+
+		//  unbuttonImage
+		//
+		//  This static function will unbutton the content of a read-only view of an image to an RGB train.
+		//
+		//  PARAMETERS
+		//
+		//		ResourceView&	-		Const reference to the view of the image to be unbuttoned to a Train
+		//
+		//  RETURNS
+		//
+		//		Train*			-		Pointer to the image Train, NULL if it could not be unbuttoned
+		//
+		//  NOTES
+		//
+		//		1.		Unbuttoning never writes to the in-memory image, so the view may be a read-only mapping.
+		//
+
+		static Train<RGB>* unbuttonImage(const ResourceView& Image) {
+			if (!Image.isValid()) return nullptr;
+			return unbuttonImage(const_cast<BYTE*>(Image.getData()), Image.getSize());
 		}
 
 		//  unbuttonImage
@@ -521,7 +592,10 @@ namespace xymorg {
 				BlockNo++;
 			}
 
-			//  Capture each of the image frames in turn and append to the train
+			//  Locate the first block of each of the image frames, a frame cannot occupy less than one block
+			size_t*		FrameBlock = new size_t[Map.NumBlocks];									//  First block of each frame
+			size_t		NumFrames = 0;															//  Number of frames
+
 			while (BlockNo < Map.NumBlocks) {
 
 				//  Scan for the next Start-Of-Frame (Either a GCE or ID block)
@@ -531,17 +605,8 @@ namespace xymorg {
 					BlockNo++;
 				}
 
-				//  Unbutton the Frame
 				if (BlockNo < Map.NumBlocks) {
-					Frame<RGB>* pFrame = unbuttonFrame(Map, BlockNo, pGCT, GCTEnts);
-					if (pFrame == nullptr) {
-						delete pTrain;
-						free(Map.Blocks);
-						Map.NBA = Map.NumBlocks = 0;
-						return nullptr;
-					}
-
-					pTrain->append(pFrame);
+					FrameBlock[NumFrames++] = BlockNo;
 
 					//  Skip over the Frame
 					if (Map.Blocks[BlockNo].BlockType == GIF_BLOCK_GCE) BlockNo += 2;
@@ -549,6 +614,35 @@ namespace xymorg {
 				}
 			}
 
+			//  Unbutton the frames concurrently, each frame has an independent LZW stream and its own Raster Buffer
+			Frame<RGB>**	Frames = new Frame<RGB>*[NumFrames + 1];
+			WorkGang::run(NumFrames, [&](size_t FX) {
+				Frames[FX] = unbuttonFrame(Map, FrameBlock[FX], pGCT, GCTEnts);
+			});
+
+			//  Append the frames to the train in image order
+			bool		Failed = false;															//  A frame could not be unbuttoned
+			for (size_t FX = 0; FX < NumFrames; FX++) {
+				if (Frames[FX] == nullptr) Failed = true;
+			}
+
+			for (size_t FX = 0; FX < NumFrames; FX++) {
+				if (Failed) {
+					if (Frames[FX] != nullptr) delete Frames[FX];
+				}
+				else pTrain->append(Frames[FX]);
+			}
+
+			delete[] Frames;
+			delete[] FrameBlock;
+
+			if (Failed) {
+				delete pTrain;
+				free(Map.Blocks);
+				Map.NBA = Map.NumBlocks = 0;
+				return nullptr;
+			}
+
 			//  Free the Map Blocks
 			if (Map.Blocks != nullptr) free(Map.Blocks);
 
@@ -690,45 +784,32 @@ namespace xymorg {
 				return nullptr;
 			}
 
-			//  Form the input and output ByteStreams to use
+			//  Form the input stream to use
 			SegmentedStream		bsIn((BYTE *) &pEEB->segment, EEBSize - 1);
 
-			//  The output bytestream is initialised with the number of pixels in the image, this prevents overrun
-			ByteStream		bsOut(IH * IW);
-
-			//  Decode the image
-			if (!Decoder.decode(bsIn, bsOut, pEEB->nativecodesize)) {
+			//  Check that there is input available
+			if (bsIn.getRemainder() == 0) {
 				delete pRB;
 				std::cerr << "ERROR: LZW CODEC failed to decode a GIF image contents." << std::endl;
 				return nullptr;
 			}
 
-			//  Check the decoded image size
-			ImgSize = bsOut.getBytesWritten();
-			if (!Decoder.wasDecodeClean()) std::cerr << "WARNING: The GIF image decoder did NOT terminate as expected after reading: " << bsOut.getBytesWritten() << " pixels (" << Decoder.getTokenCount() << " tokens), image may be corrupt." << std::endl;
-			if (ImgSize != (IH * IW)) {
-				std::cerr << "WARNING: Decoded image size: " << ImgSize << " does not match expected size: " << IH * IW << " pixels." << std::endl;
-				if (ImgSize > IH * IW) {
-					std::cerr << "WARNING: " << ImgSize - (IH * IW) << " pixel overrun has been discarded." << std::endl;
-					ImgSize = IH * IW;
-				}
-				else {
-					std::cerr << "WARNING: " << (IH * IW) - ImgSize << " pixel underrun is missing from the image, after reading: " << bsIn.getBytesRead() << " bytes of segmented data." << std::endl;
-				}
-			}
+			//  Build the palette lookup table, indices beyond the colour table map to the first entry
+			RGB			LUT[256] = {};
+			buildPaletteLUT(LUT, pCT, CTEnts);
 
-			//  Obtain a linear iterator for the Raster Buffer
-			RasterBuffer<RGB>::iterator WIt = pRB->begin();
-			BYTE*  pBuffer = bsOut.getBufferAddress();
+			//  Obtain the decoding emitter and emit the decoded pixels directly into each row of the raster buffer
+			LZW::Emitter	DEmit = Decoder.decode(bsIn, pEEB->nativecodesize);
 
-			//  Fill the image into the Raster Buffer
-			for (size_t Pixel = 0; Pixel < ImgSize; Pixel++) {
-				//  If the colour index is greater than the number of entries in the colour table use the first entry
-				if (pBuffer[Pixel] > CTEnts) *WIt = pCT->Entry[0];
-				else *WIt = pCT->Entry[pBuffer[Pixel]];
-				WIt++;
+			for (size_t Row = 0; Row < IH; Row++) {
+				size_t	RowPixels = DEmit.next(pRB->getPixel(Row, 0), IW, LUT);
+				ImgSize += RowPixels;
+				if (RowPixels < IW) break;
 			}
 
+			//  Check the decoded image size
+			reportDecodeSize(IH, IW, ImgSize, drainOverrun(DEmit), Decoder, bsIn);
+
 			//  Return the constructed Raster Buffer
 			return pRB;
 		}
@@ -770,83 +851,130 @@ namespace xymorg {
 				return nullptr;
 			}
 
-			//  Form the input and output ByteStreams to use
+			//  Form the input stream to use
 			SegmentedStream		bsIn((BYTE*)&pEEB->segment, EEBSize - 1);
 
-			//  The output bytestream is initialised with the number of pixels in the image, this prevents overrun
-			ByteStream		bsOut(IH * IW);
-
-			//  Decode the image
-			if (!Decoder.decode(bsIn, bsOut, pEEB->nativecodesize)) {
+			//  Check that there is input available
+			if (bsIn.getRemainder() == 0) {
 				delete pRB;
 				std::cerr << "ERROR: LZW CODEC failed to decode a GIF image contents." << std::endl;
 				return nullptr;
 			}
 
-			//  Check the decoded image size
-			ImgSize = bsOut.getBytesWritten();
-			if (!Decoder.wasDecodeClean()) std::cerr << "WARNING: The GIF image decoder did NOT terminate as expected after reading: " << bsOut.getBytesWritten() << " pixels (" << Decoder.getTokenCount() << " tokens), image may be corrupt." << std::endl;
-			if (ImgSize != (IH * IW)) {
-				std::cerr << "WARNING: Decoded image size: " << ImgSize << " does not match expected size: " << IH * IW << " pixels." << std::endl;
-				if (ImgSize > IH * IW) {
-					std::cerr << "WARNING: " << ImgSize - (IH * IW) << " pixel overrun has been discarded." << std::endl;
-					ImgSize = IH * IW;
-				}
-				else {
-					std::cerr << "WARNING: " << (IH * IW) - ImgSize << " pixel underrun is missing from the image, after reading: " << bsIn.getBytesRead() << " bytes of segmented data." << std::endl;
+			//  Build the palette lookup table, indices beyond the colour table map to the first entry
+			RGB			LUT[256] = {};
+			buildPaletteLUT(LUT, pCT, CTEnts);
+
+			//  Obtain the decoding emitter
+			LZW::Emitter	DEmit = Decoder.decode(bsIn, pEEB->nativecodesize);
+
+			//  The interlaced image is emitted in 4 passes, every 8th row from row 0, every 8th row from row 4,
+			//  every 4th row from row 2 and finally every 2nd row from row 1
+			const size_t	PassStart[4] = { 0, 4, 2, 1 };
+			const size_t	PassStep[4] = { 8, 8, 4, 2 };
+			bool			Short = false;
+
+			for (int Pass = 0; Pass < 4 && !Short; Pass++) {
+				for (size_t Row = PassStart[Pass]; Row < IH; Row += PassStep[Pass]) {
+					size_t	RowPixels = DEmit.next(pRB->getPixel(Row, 0), IW, LUT);
+					ImgSize += RowPixels;
+					if (RowPixels < IW) {
+						Short = true;
+						break;
+					}
 				}
 			}
 
-			//  Obtain a linear iterator for the Raster Buffer
-			BYTE*	pBuffer = bsOut.getBufferAddress();
-			size_t	Pixel = 0;
+			//  Check the decoded image size
+			reportDecodeSize(IH, IW, ImgSize, drainOverrun(DEmit), Decoder, bsIn);
 
-			//  Perform a Row/Column iteration of the target raster buffer filling each 8th row
-			for (RasterBuffer<RGB>::iterator RIt = pRB->top(); RIt != pRB->bottom(); RIt++) {
-				if ((RIt.getIndex() % 8) == 0) {
-					for (RasterBuffer<RGB>::iterator CIt = pRB->left(RIt); CIt != pRB->right(RIt); CIt++) {
-						if (pBuffer[Pixel] > CTEnts) *CIt = pCT->Entry[0];
-						else *CIt = pCT->Entry[pBuffer[Pixel]];
-						Pixel++;
-					}
-				}
-			}
+			//  Return the constructed Raster Buffer
+			return pRB;
+		}
 
-			//  Perform a Row/Column iteration of the target raster buffer filling each 8th row starting from row 4
-			for (RasterBuffer<RGB>::iterator RIt = pRB->top(); RIt != pRB->bottom(); RIt++) {
-				if (((RIt.getIndex() - 4) % 8) == 0) {
-					for (RasterBuffer<RGB>::iterator CIt = pRB->left(RIt); CIt != pRB->right(RIt); CIt++) {
-						if (pBuffer[Pixel] > CTEnts) *CIt = pCT->Entry[0];
-						else *CIt = pCT->Entry[pBuffer[Pixel]];
-						Pixel++;
-					}
-				}
-			}
+		//  buildPaletteLUT
+		//
+		//  This static function will build the 256 entry lookup table that maps an LZW symbol (colour index) to a colour
+		//
+		//  PARAMETERS
+		//
+		//		RGB*							-		Pointer to the 256 entry lookup table to fill
+		//		GIF_ODI_COLOUR_TABLE*			-		Pointer to the Colour Table to use
+		//		size_t							-		Number of entries in the Colour Table
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//		If the colour index is greater than the number of entries in the colour table the first entry is used
+		//
 
-			//  Perform a Row/Column iteration of the target raster buffer filling each 4th row starting from row 2
-			for (RasterBuffer<RGB>::iterator RIt = pRB->top(); RIt != pRB->bottom(); RIt++) {
-				if (((RIt.getIndex() - 2) % 4) == 0) {
-					for (RasterBuffer<RGB>::iterator CIt = pRB->left(RIt); CIt != pRB->right(RIt); CIt++) {
-						if (pBuffer[Pixel] > CTEnts) *CIt = pCT->Entry[0];
-						else *CIt = pCT->Entry[pBuffer[Pixel]];
-						Pixel++;
-					}
-				}
+		static void buildPaletteLUT(RGB* pLUT, GIF_ODI_COLOUR_TABLE* pCT, size_t CTEnts) {
+			for (size_t Index = 0; Index < 256; Index++) {
+				if (Index > CTEnts) pLUT[Index] = pCT->Entry[0];
+				else pLUT[Index] = pCT->Entry[Index];
 			}
+			return;
+		}
 
-			//  Perform a Row/Column iteration of the target raster buffer filling each 2th row starting from row 1
-			for (RasterBuffer<RGB>::iterator RIt = pRB->top(); RIt != pRB->bottom(); RIt++) {
-				if (((RIt.getIndex() - 1) % 2) == 0) {
-					for (RasterBuffer<RGB>::iterator CIt = pRB->left(RIt); CIt != pRB->right(RIt); CIt++) {
-						if (pBuffer[Pixel] > CTEnts) *CIt = pCT->Entry[0];
-						else *CIt = pCT->Entry[pBuffer[Pixel]];
-						Pixel++;
-					}
-				}
+		//  drainOverrun
+		//
+		//  This static function will consume any decoded pixels that remain after the image has been filled
+		//
+		//  PARAMETERS
+		//
+		//		LZW::Emitter&					-		Reference to the decoding emitter
+		//
+		//  RETURNS
+		//
+		//		size_t							-		Number of surplus pixels discarded
+		//
+		//  NOTES
+		//
+		//		Draining the emitter to the end code is needed for the clean termination signal to be set
+		//
+
+		static size_t drainOverrun(LZW::Emitter& DEmit) {
+			size_t		Overrun = 0;																//  Surplus pixels
+
+			while (DEmit.hasNext()) {
+				DEmit.next();
+				Overrun++;
 			}
 
-			//  Return the constructed Raster Buffer
-			return pRB;
+			//  Return the count of surplus pixels
+			return Overrun;
+		}
+
+		//  reportDecodeSize
+		//
+		//  This static function will report any anomalies in the size or termination of a decoded image
+		//
+		//  PARAMETERS
+		//
+		//		size_t							-		Image Rows
+		//		size_t							-		Image Columns
+		//		size_t							-		Number of pixels filled into the image
+		//		size_t							-		Number of surplus pixels discarded
+		//		LZW&							-		Reference to the LZW CODEC used for decoding
+		//		SegmentedStream&				-		Reference to the input stream
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+
+		static void reportDecodeSize(size_t IH, size_t IW, size_t ImgSize, size_t Overrun, LZW& Decoder, SegmentedStream& bsIn) {
+			if (!Decoder.wasDecodeClean()) std::cerr << "WARNING: The GIF image decoder did NOT terminate as expected after reading: " << ImgSize + Overrun << " pixels (" << Decoder.getTokenCount() << " tokens), image may be corrupt." << std::endl;
+			if (Overrun > 0) {
+				std::cerr << "WARNING: Decoded image size: " << ImgSize + Overrun << " does not match expected size: " << IH * IW << " pixels." << std::endl;
+				std::cerr << "WARNING: " << Overrun << " pixel overrun has been discarded." << std::endl;
+			}
+			else if (ImgSize != (IH * IW)) {
+				std::cerr << "WARNING: Decoded image size: " << ImgSize << " does not match expected size: " << IH * IW << " pixels." << std::endl;
+				std::cerr << "WARNING: " << (IH * IW) - ImgSize << " pixel underrun is missing from the image, after reading: " << bsIn.getBytesRead() << " bytes of segmented data." << std::endl;
+			}
+			return;
 		}
 
 		//  mapImage
@@ -1420,12 +1548,7 @@ namespace xymorg {
 		static void		optimiseAnimationFrames(Train<RGB>* pTrain, size_t OptFNo, RasterBuffer<RGB>& RefImg, SWITCHES Opts) {
 			Frame<RGB>*			pFrame = pTrain->getFirstFrame();												//  Frame being optimised
 			size_t				FNo = 1;																		//  Frame number
-			RasterBuffer<RGB>*	pRegionBfr = nullptr;															//  Region of Reference Image
-			BoundingBox			bbReg = {};																		//  Bounding of image region
-			BoundingBox			bbDiff = {};																	//  Bounding of difference region
-			size_t				FPix = 0;																		//  Number of pixels in the frame
-			size_t				DRPix = 0;																		//  Number of pixels in the defference region
-			size_t				NMPct = 0;																		//  Non-matching region
+			size_t				NumFrames = 0;																	//  Number of frames to optimise
 			size_t				Expansion = 0;																	//  Expansion factor for alternate fragmenter
 
 			//  If using the alternate fragmenter then set the allowed region expansion
@@ -1436,117 +1559,179 @@ namespace xymorg {
 			}
 
 			//  Position to the frame to be optimised
-			while (FNo < OptFNo) {
+			while (FNo < OptFNo && pFrame != nullptr) {
 				pFrame = pFrame->getNext();
 				FNo++;
 			}
+			if (pFrame == nullptr) return;
 
-			//  If the frame is a region of the canvas image then create a temporary region of the Reference image
-			if (pFrame->getRRow() != 0 || pFrame->getRCol() != 0 || pFrame->getHeight() != RefImg.getHeight() || pFrame->getWidth() != RefImg.getWidth()) {
-				bbReg.Top = pFrame->getRRow();
-				bbReg.Left = pFrame->getRCol();
-				bbReg.Bottom = (bbReg.Top + pFrame->getHeight()) - 1;
-				bbReg.Right = (bbReg.Left + pFrame->getWidth()) - 1;
-
-				pRegionBfr = new RasterBuffer<RGB>(RefImg, bbReg);
-			}
-			else {
-				bbReg.Top = 0;
-				bbReg.Bottom = RefImg.getHeight() - 1;
-				bbReg.Left = 0;
-				bbReg.Right = RefImg.getWidth() - 1;
-				pRegionBfr = &RefImg;
-			}
-
-			//  Perform a simple match to find the difference region
-			if (pRegionBfr->matches(pFrame->buffer(), bbDiff)) {
+			//  Capture the frames to be optimised
+			for (Frame<RGB>* pCFrame = pFrame; pCFrame != nullptr; pCFrame = pCFrame->getNext()) NumFrames++;
+			Frame<RGB>**	Frames = new Frame<RGB>*[NumFrames];
+			FOPLAN*			Plan = new FOPLAN[NumFrames];
+			NumFrames = 0;
+			for (Frame<RGB>* pCFrame = pFrame; pCFrame != nullptr; pCFrame = pCFrame->getNext()) Frames[NumFrames++] = pCFrame;
 
-				//  Delete the temporary buffer
-				if (pRegionBfr != &RefImg) delete pRegionBfr;
+			//
+			//  Plan the frames concurrently.
+			//  After a frame has been optimised the reference image holds exactly the frame content wherever the frame was
+			//  drawn, so when the preceding frame covers the whole canvas that frame IS the reference image for the next frame.
+			//  Only frames that follow a partial (tile) frame depend on the optimisation of the frames before them, these
+			//  are planned in sequence as the reference image is brought up to date.
+			//
 
-				//  Get the next frame (if any)
-				pFrame = pFrame->getNext();
+			WorkGang::run(NumFrames, [&](size_t FX) {
+				if (FX == 0) planAnimationFrame(OptFNo, Frames[FX], RefImg, Expansion, Plan[FX], Opts);
+				else if (isFullCanvas(Frames[FX - 1], RefImg)) planAnimationFrame(OptFNo + FX, Frames[FX], Frames[FX - 1]->buffer(), Expansion, Plan[FX], Opts);
+			});
 
-				//  Boundary condition the frame (or tile) completely matches the Reference image and can therefore be removed
-				pTrain->deleteFrame(FNo);
+			//  Apply the plans in train order, updating the reference image
+			for (size_t FX = 0; FX < NumFrames; FX++) {
+				pFrame = Frames[FX];
 
-				//  If there are no more frames then return to caller
-				if (pFrame == nullptr) return;
+				//  Plan any frame that depends on the current reference image
+				if (!Plan[FX].Planned) planAnimationFrame(FNo, pFrame, RefImg, Expansion, Plan[FX], Opts);
 
-				//  Recurse - to process the frame now at the requested position
-				return optimiseAnimationFrames(pTrain, OptFNo, RefImg, Opts);
-			}
+				switch (Plan[FX].Action) {
+				case FOPLAN_DELETE:
+					//  The frame (or tile) completely matches the Reference image and can therefore be removed
+					pTrain->deleteFrame(FNo);
+					break;
 
-			//  Incomplete match - determine the percentage size of the non-matching region
-			FPix = ((bbReg.Bottom - bbReg.Top) + 1) * ((bbReg.Right - bbReg.Left) + 1);
-			DRPix = ((bbDiff.Bottom - bbDiff.Top) + 1) * ((bbDiff.Right - bbDiff.Left) + 1);
-			NMPct = (DRPix * 100) / FPix;
+				case FOPLAN_TILE:
+					//  Replace the existing buffer in the frame with the difference region and adjust the origin
+					delete pFrame->getBuffer();
+					pFrame->setBuffer(Plan[FX].pTile);
+					pFrame->setRRow(pFrame->getRRow() + Plan[FX].bbDiff.Top);
+					pFrame->setRCol(pFrame->getRCol() + Plan[FX].bbDiff.Left);
 
-			//  If the difference is less than the 20% threshold then save the Difference Region as a single tile
-			if (NMPct < 20) {
+					//  Update the reference image
+					RefImg.blit(pFrame->buffer(), pFrame->getRRow(), pFrame->getRCol());
+					FNo++;
+					break;
 
-				//  Delete the temporary buffer
-				if (pRegionBfr != &RefImg) delete pRegionBfr;
+				case FOPLAN_FRAGMENT:
+					//  Replace the current frame with the mini-train of fragments
+					FNo += spliceFragments(pTrain, pFrame, Plan[FX].pFrags, RefImg);
+					break;
 
-				//  Create a new buffer from the difference region
-				pRegionBfr = new RasterBuffer<RGB>(pFrame->buffer(), bbDiff);
+				default:
+					//  Use this frame as-is, update the reference image
+					RefImg.blit(pFrame->buffer(), pFrame->getRRow(), pFrame->getRCol());
+					FNo++;
+					break;
+				}
+			}
 
-				//  Delete the existing buffer in the frame
-				delete pFrame->getBuffer();
+			//  Free the plans
+			delete[] Frames;
+			delete[] Plan;
 
-				//  Place the new buffer in the frame
-				pFrame->setBuffer(pRegionBfr);
+			//  Return to caller
+			return;
+		}
 
-				//  Adjust the origin
-				pFrame->setRRow(pFrame->getRRow() + bbDiff.Top);
-				pFrame->setRCol(pFrame->getRCol() + bbDiff.Left);
+		//  planAnimationFrame
+		//
+		//  This static function will determine how a frame is to be optimised against the reference image
+		//
+		//  PARAMETERS
+		//
+		//		size_t					-	Source frame number
+		//		Frame*					-	Pointer to the frame to be optimised
+		//		RasterBuffer<RGB>&		-	Reference to the reference image buffer i.e. canvas image after displaying the previous frame
+		//		size_t					-	Expansion factor for the alternate fragmenter
+		//		FOPLAN&					-	Reference to the plan to be filled
+		//		SWITCHES				-   GIF_ switch array
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//		Neither the frame nor the reference image are modified, frames may be planned concurrently.
+		//
 
-				//  Update the reference image
-				RefImg.blit(pFrame->buffer(), pFrame->getRRow(), pFrame->getRCol());
+		static void		planAnimationFrame(size_t SFNo, Frame<RGB>* pFrame, RasterBuffer<RGB>& RefImg, size_t Expansion, FOPLAN& Plan, SWITCHES Opts) {
+			RasterBuffer<RGB>*	pRegionBfr = nullptr;															//  Region of Reference Image
+			BoundingBox			bbReg = {};																		//  Bounding of image region
+			size_t				FPix = 0;																		//  Number of pixels in the frame
+			size_t				DRPix = 0;																		//  Number of pixels in the defference region
+			size_t				NMPct = 0;																		//  Non-matching region
 
-				//  Get the next frame
-				pFrame = pFrame->getNext();
+			Plan.Planned = true;
 
-				//  If there are no more frames then return to caller
-				if (pFrame == nullptr) return;
+			//  If the frame is a region of the canvas image then create a temporary region of the Reference image
+			if (!isFullCanvas(pFrame, RefImg)) {
+				bbReg.Top = pFrame->getRRow();
+				bbReg.Left = pFrame->getRCol();
+				bbReg.Bottom = (bbReg.Top + pFrame->getHeight()) - 1;
+				bbReg.Right = (bbReg.Left + pFrame->getWidth()) - 1;
 
-				//  Recurse - to process the next frame
-				return optimiseAnimationFrames(pTrain, OptFNo + 1, RefImg, Opts);
+				pRegionBfr = new RasterBuffer<RGB>(RefImg, bbReg);
+			}
+			else {
+				bbReg.Top = 0;
+				bbReg.Bottom = RefImg.getHeight() - 1;
+				bbReg.Left = 0;
+				bbReg.Right = RefImg.getWidth() - 1;
+				pRegionBfr = &RefImg;
 			}
 
+			//  Perform a simple match to find the difference region
+			if (pRegionBfr->matches(pFrame->buffer(), Plan.bbDiff)) Plan.Action = FOPLAN_DELETE;
+			else {
+				//  Incomplete match - determine the percentage size of the non-matching region
+				FPix = ((bbReg.Bottom - bbReg.Top) + 1) * ((bbReg.Right - bbReg.Left) + 1);
+				DRPix = ((Plan.bbDiff.Bottom - Plan.bbDiff.Top) + 1) * ((Plan.bbDiff.Right - Plan.bbDiff.Left) + 1);
+				NMPct = (DRPix * 100) / FPix;
+
+				//  If the difference is less than the 20% threshold then save the Difference Region as a single tile
+				if (NMPct < 20) {
+					Plan.Action = FOPLAN_TILE;
+					Plan.pTile = new RasterBuffer<RGB>(pFrame->buffer(), Plan.bbDiff);
+				}
+				else {
+					//  Build a mini-train of frames to replace the current frame
+					if (Opts & GIF_FRAGMENT_ALTERNATE) Plan.pFrags = fragmentFrame2(SFNo, pFrame, pRegionBfr, Plan.bbDiff, Expansion);
+					else Plan.pFrags = fragmentFrame(SFNo, pFrame, pRegionBfr, Plan.bbDiff);
 
-			//  Build a mini-train of frames to replace the current frame
-			Frame<RGB>* pRT = nullptr;
-			if (Opts & GIF_FRAGMENT_ALTERNATE) pRT = fragmentFrame2(OptFNo, pFrame, pRegionBfr, bbDiff, Expansion);
-			else pRT = fragmentFrame(OptFNo, pFrame, pRegionBfr, bbDiff);
+					//  If no fragmentation was possible use the frame as-is
+					if (Plan.pFrags == nullptr) Plan.Action = FOPLAN_ASIS;
+					else Plan.Action = FOPLAN_FRAGMENT;
+				}
+			}
 
 			//  Delete the temporary buffer
 			if (pRegionBfr != &RefImg) delete pRegionBfr;
 
-			//  If no fragmentation was possible 
-			if (pRT == nullptr) {
-
-				//  Use this frame as-is
-				//  Update the reference image
-				RefImg.blit(pFrame->buffer(), pFrame->getRRow(), pFrame->getRCol());
-
-				//  Get the next frame
-				pFrame = pFrame->getNext();
-
-				//  If there are no more frames then return to caller
-				if (pFrame == nullptr) return;
+			//  Return to caller
+			return;
+		}
 
-				//  Recurse - to process the next frame
-				return optimiseAnimationFrames(pTrain, OptFNo + 1, RefImg, Opts);
-			}
+		//  spliceFragments
+		//
+		//  This static function will replace a frame in the train with a mini-train of fragments
+		//
+		//  PARAMETERS
+		//
+		//		Train*					-	Pointer to the Canonical Train
+		//		Frame*					-	Pointer to the frame to be replaced (deleted)
+		//		Frame*					-	Pointer to the first frame of the fragments mini-train
+		//		RasterBuffer<RGB>&		-	Reference to the reference image buffer to be updated
+		//
+		//  RETURNS
+		//
+		//		size_t					-	Number of fragments spliced into the train
+		//
+		//  NOTES
+		//
+		//		The delay of the replaced frame is set in the last fragment.
+		//
 
-			//
-			//  Replace the current frame with the collection of frames (tiles) from the fragmentation process.
-			//  The delay must be set in the last frame
-			//
+		static size_t	spliceFragments(Train<RGB>* pTrain, Frame<RGB>* pFrame, Frame<RGB>* pRT, RasterBuffer<RGB>& RefImg) {
+			Frame<RGB>*		pLastFrag = pRT;																//  Last fragment
+			size_t			Frags = 1;																		//  Number of fragments
 
-			Frame<RGB>*		pLastFrag = pRT;
-			size_t			Frags = 1;
 			while (pLastFrag->getNext() != nullptr) {
 				Frags++;
 				pLastFrag = pLastFrag->getNext();
@@ -1572,14 +1757,30 @@ namespace xymorg {
 				else pFrame = pFrame->getNext();
 			}
 
-			//  Position to the next frame
-			pFrame = pLastFrag->getNext();
+			//  Return the number of fragments
+			return Frags;
+		}
 
-			//  If there are no more frames then return to caller
-			if (pFrame == nullptr) return;
+		//  isFullCanvas
+		//
+		//  This static function will determine if a frame covers the whole of the canvas
+		//
+		//  PARAMETERS
+		//
+		//		Frame*					-	Pointer to the frame
+		//		RasterBuffer<RGB>&		-	Reference to the canvas (reference) image
+		//
+		//  RETURNS
+		//
+		//		bool					-	true if the frame covers the whole canvas, otherwise false
+		//
+		//  NOTES
+		//
 
-			//  Recurse - to process the next frame
-			return optimiseAnimationFrames(pTrain, OptFNo + Frags, RefImg, Opts);
+		static bool		isFullCanvas(Frame<RGB>* pFrame, RasterBuffer<RGB>& RefImg) {
+			if (pFrame->getRRow() != 0 || pFrame->getRCol() != 0) return false;
+			if (pFrame->getHeight() != RefImg.getHeight() || pFrame->getWidth() != RefImg.getWidth()) return false;
+			return true;
 		}
 
 		//  fragmentFrame
@@ -1634,81 +1835,87 @@ namespace xymorg {
 			if ((pFrame->getHeight() * pFrame->getWidth()) <= 2000) return nullptr;
 
 			//  Make a pass over the difference region assigning pixels to fragments
-			for (RasterBuffer<RGB>::iterator RIt = pFrame->buffer().top(bbDiff); RIt != pFrame->buffer().bottom(bbDiff); RIt++) {
-				for (RasterBuffer<RGB>::iterator CIt = pFrame->buffer().left(RIt); CIt != pFrame->buffer().right(RIt); CIt++) {
-					//  Check against the reference image for a mismatched pixel
-					MPR = RIt.getIndex();
-					MPC = CIt.getIndex();
-					if (*CIt != (*pRefImg)(MPR, MPC)) {
-						//  Search the existing fragments to see if the new pixel belongs to an existing fragment
-						PixelDone = false;
-						for (size_t FX = 0; FX < FragsInPlay; FX++) {
-							if (MPR >= Fragment[FX].Top && MPR <= Fragment[FX].Bottom && MPC >= Fragment[FX].Left && MPC <= Fragment[FX].Right) {
-								PixelDone = true;
-								FPIx[FX]++;
-								break;
-							}
+			for (MPR = bbDiff.Top; MPR <= bbDiff.Bottom; MPR++) {
+				const RGB*	pFRow = pFrame->buffer().getPixel(MPR, 0);								//  Frame row
+				const RGB*	pRRow = pRefImg->getPixel(MPR, 0);										//  Reference row
+
+				MPC = bbDiff.Left;
+				while (MPC <= bbDiff.Right) {
+					//  Skip to the next mismatched pixel in the row
+					MPC += RasterBuffer<RGB>::firstMismatch(pFRow + MPC, pRRow + MPC, (bbDiff.Right + 1) - MPC);
+					if (MPC > bbDiff.Right) break;
+
+					//  Search the existing fragments to see if the new pixel belongs to an existing fragment
+					PixelDone = false;
+					for (size_t FX = 0; FX < FragsInPlay; FX++) {
+						if (MPR >= Fragment[FX].Top && MPR <= Fragment[FX].Bottom && MPC >= Fragment[FX].Left && MPC <= Fragment[FX].Right) {
+							PixelDone = true;
+							FPIx[FX]++;
+							break;
 						}
+					}
 
-						//  If the pixel was not consumed by an existing fragment then it will either expand an existing fragment
-						//  or seed a new fragment
+					//  If the pixel was not consumed by an existing fragment then it will either expand an existing fragment
+					//  or seed a new fragment
 
-						if (!PixelDone) {
+					if (!PixelDone) {
 
-							//  Boundary condition - there are no existing fragments
-							if (FragsInPlay == 0) {
-								Fragment[0].Top = MPR;
-								Fragment[0].Bottom = MPR;
-								Fragment[0].Left = MPC;
-								Fragment[0].Right = MPC;
-								FragsInPlay++;
-								FPIx[0]++;
-							}
-							else {
-								//  Test for expansion of an existing fragment
-								BDFX = 10;
-								for (size_t FX = 0; FX < FragsInPlay; FX++) {
-
-									//  Compute the row distance
-									if (MPR >= Fragment[FX].Top && MPR <= Fragment[FX].Bottom) DR = 0;
-									else if (MPR < Fragment[FX].Top) DR = int(MPR) - int(Fragment[FX].Top);
-									else DR = int(MPR) - int(Fragment[FX].Bottom);
-
-									//  Compute the column distance
-									if (MPC >= Fragment[FX].Left && MPC <= Fragment[FX].Right) DC = 0;
-									else if (MPC < Fragment[FX].Left) DC = int(MPC) - int(Fragment[FX].Left);
-									else DC = int(MPC) - int(Fragment[FX].Right);
-
-									//  Determine if this fragment is the best match
-									if (BDFX == 10 || (((DR * DR) + (DC * DC))) < ((BDR * BDR) + (BDC * BDC))) {
-										BDFX = FX;
-										BDR = DR;
-										BDC = DC;
-									}
+						//  Boundary condition - there are no existing fragments
+						if (FragsInPlay == 0) {
+							Fragment[0].Top = MPR;
+							Fragment[0].Bottom = MPR;
+							Fragment[0].Left = MPC;
+							Fragment[0].Right = MPC;
+							FragsInPlay++;
+							FPIx[0]++;
+						}
+						else {
+							//  Test for expansion of an existing fragment
+							BDFX = 10;
+							for (size_t FX = 0; FX < FragsInPlay; FX++) {
+
+								//  Compute the row distance
+								if (MPR >= Fragment[FX].Top && MPR <= Fragment[FX].Bottom) DR = 0;
+								else if (MPR < Fragment[FX].Top) DR = int(MPR) - int(Fragment[FX].Top);
+								else DR = int(MPR) - int(Fragment[FX].Bottom);
+
+								//  Compute the column distance
+								if (MPC >= Fragment[FX].Left && MPC <= Fragment[FX].Right) DC = 0;
+								else if (MPC < Fragment[FX].Left) DC = int(MPC) - int(Fragment[FX].Left);
+								else DC = int(MPC) - int(Fragment[FX].Right);
+
+								//  Determine if this fragment is the best match
+								if (BDFX == 10 || (((DR * DR) + (DC * DC))) < ((BDR * BDR) + (BDC * BDC))) {
+									BDFX = FX;
+									BDR = DR;
+									BDC = DC;
 								}
+							}
 
-								//  Determine if the closest fragment is close enough to cause an expansion
-								if ((abs(BDR) <= 5 && abs(BDC) <= 5) || FragsInPlay == 10) {
-									if (BDR < 0) Fragment[BDFX].Top += BDR;
-									else Fragment[BDFX].Bottom += BDR;
-									if (BDC < 0) Fragment[BDFX].Left += BDC;
-									else Fragment[BDFX].Right += BDC;
-									FPIx[BDFX]++;
-									PixelDone = true;
-								}
+							//  Determine if the closest fragment is close enough to cause an expansion
+							if ((abs(BDR) <= 5 && abs(BDC) <= 5) || FragsInPlay == 10) {
+								if (BDR < 0) Fragment[BDFX].Top += BDR;
+								else Fragment[BDFX].Bottom += BDR;
+								if (BDC < 0) Fragment[BDFX].Left += BDC;
+								else Fragment[BDFX].Right += BDC;
+								FPIx[BDFX]++;
+								PixelDone = true;
+							}
 
-								//  If the pixel was not consumed then use it to initialise a new fragment
-								if (!PixelDone) {
-									Fragment[FragsInPlay].Top = MPR;
-									Fragment[FragsInPlay].Bottom = MPR;
-									Fragment[FragsInPlay].Left = MPC;
-									Fragment[FragsInPlay].Right = MPC;
-									FPIx[FragsInPlay]++;
-									FragsInPlay++;								
-								}
+							//  If the pixel was not consumed then use it to initialise a new fragment
+							if (!PixelDone) {
+								Fragment[FragsInPlay].Top = MPR;
+								Fragment[FragsInPlay].Bottom = MPR;
+								Fragment[FragsInPlay].Left = MPC;
+								Fragment[FragsInPlay].Right = MPC;
+								FPIx[FragsInPlay]++;
+								FragsInPlay++;								
 							}
 						}
 					}
+
+					//  Move past the mismatched pixel
+					MPC++;
 				}
 
 				//  After every complete row perform an optimisation of the fragments and anti-fragments identified to collapse
@@ -2088,9 +2295,7 @@ namespace xymorg {
 					if (PMReg.Top == Frag.Top) XT = false;
 					else {
 						//  To expand upwards all pixels in the row above the current region MUST match
-						for (size_t Col = PMReg.Left; Col <= PMReg.Right; Col++) {
-							if (pFrame->buffer()(PMReg.Top - 1, Col) != Ref(PMReg.Top - 1, Col)) XT = false;
-						}
+						if (!spanMatches(pFrame->buffer(), Ref, PMReg.Top - 1, PMReg.Left, PMReg.Right)) XT = false;
 
 						//  If expansion is still permitted update the bounds
 						if (XT) PMReg.Top--;
@@ -2103,9 +2308,7 @@ namespace xymorg {
 					if (PMReg.Bottom == Frag.Bottom) XB = false;
 					else {
 						//  To expand downwards all pixels in the row bulow the current region MUST match
-						for (size_t Col = PMReg.Left; Col <= PMReg.Right; Col++) {
-							if (pFrame->buffer()(PMReg.Bottom + 1, Col) != Ref(PMReg.Bottom + 1, Col)) XB = false;
-						}
+						if (!spanMatches(pFrame->buffer(), Ref, PMReg.Bottom + 1, PMReg.Left, PMReg.Right)) XB = false;
 
 						//  If expansion is still permitted update the bounds
 						if (XB) PMReg.Bottom++;
@@ -2147,6 +2350,31 @@ namespace xymorg {
 			return PMReg;
 		}
 
+		//  spanMatches
+		//
+		//  This static function will test if a span of a row in an image matches the same span in the reference image
+		//
+		//  PARAMETERS
+		//
+		//		RasterBuffer&	-		Reference to the image Raster Buffer
+		//		RasterBuffer&	-		Reference to the reference (comparison) Raster Buffer
+		//		size_t			-		Row
+		//		size_t			-		First column of the span
+		//		size_t			-		Last column of the span
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if every pixel in the span matches, otherwise false
+		//
+		//  NOTES
+		//
+
+		static bool		spanMatches(RasterBuffer<RGB>& Img, RasterBuffer<RGB>& Ref, size_t Row, size_t Left, size_t Right) {
+			size_t		Count = (Right - Left) + 1;													//  Pixels in the span
+
+			return RasterBuffer<RGB>::firstMismatch(Img.getPixel(Row, Left), Ref.getPixel(Row, Left), Count) == Count;
+		}
+
 		//  fragmentFrame2
 		//
 		//  This function will fragment the passed frame using the Difference Map method
@@ -2392,11 +2620,7 @@ namespace xymorg {
 			while (pFrame != nullptr) {
 
 				//  Add the image colours
-				for (RasterBuffer<RGB>::iterator RIt = pFrame->buffer().top(); RIt != pFrame->buffer().bottom(); RIt++) {
-					for (RasterBuffer<RGB>::iterator CIt = pFrame->buffer().left(RIt); CIt != pFrame->buffer().right(RIt); CIt++) {
-						CT.add(*CIt, 1, RIt.getIndex(), CIt.getIndex());
-					}
-				}
+				countColours(pFrame, CT);
 
 				//  If the colour count is over 256 then we have to reduce the colour count in the frame
 				while (CT.getNumColours() > 256) {
@@ -2452,17 +2676,14 @@ namespace xymorg {
 				}
 
 				//  Add the image colours
-				for (RasterBuffer<RGB>::iterator RIt = pFrame->buffer().top(); RIt != pFrame->buffer().bottom(); RIt++) {
-					for (RasterBuffer<RGB>::iterator CIt = pFrame->buffer().left(RIt); CIt != pFrame->buffer().right(RIt); CIt++) {
-						CT.add(*CIt, 1, RIt.getIndex(), CIt.getIndex());
-					}
-				}
+				countColours(pFrame, CT);
 
 				//  If we have 256 or more colours then resolve
 				if (CT.getNumColours() > 256) {
 
 					//
 					//	Progressively remove frames of colour from the current image until the number of colours is 256 or less
+					//	The partitioning functions keep the colour table in step with the (reduced) frame
 					//
 
 					while (CT.getNumColours() > 256) {
@@ -2473,15 +2694,6 @@ namespace xymorg {
 						//  Check that we obtained a partition
 						if (PartColour == CT.getNumColours()) cleaveFrame(pFrame, CT);
 						else partitionFrame(pFrame, CT, PartColour);
-
-						//  Clear and recompute the colour extents and counts
-						CT.clear();
-						//  Add the image colours
-						for (RasterBuffer<RGB>::iterator RIt = pFrame->buffer().top(); RIt != pFrame->buffer().bottom(); RIt++) {
-							for (RasterBuffer<RGB>::iterator CIt = pFrame->buffer().left(RIt); CIt != pFrame->buffer().right(RIt); CIt++) {
-								CT.add(*CIt, 1, RIt.getIndex(), CIt.getIndex());
-							}
-						}
 					}
 				}
 
@@ -2493,6 +2705,33 @@ namespace xymorg {
 			return;
 		}
 
+		//  countColours
+		//
+		//  This static function will add the colours of all pixels in the passed frame to the colour table, maintaining
+		//  the extents of each colour.
+		//
+		//  PARAMETERS
+		//
+		//		Frame*					-		Pointer to the frame
+		//		ColourTable&			-		Reference to the colour table
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+
+		static void		countColours(Frame<RGB>* pFrame, ColourTable<RGB>& CT) {
+			RGB*		pRow = nullptr;																//  Pixel row
+
+			for (size_t Row = 0; Row < pFrame->getHeight(); Row++) {
+				pRow = pFrame->buffer().getPixel(Row, 0);
+				for (size_t Col = 0; Col < pFrame->getWidth(); Col++) CT.add(pRow[Col], 1, Row, Col);
+			}
+
+			//  Return to caller
+			return;
+		}
+
 		//  cleaveFrame
 		//
 		//  This static function will split the incoming frame into 2 (orthogonal to the longest axis). 
@@ -2647,6 +2886,10 @@ namespace xymorg {
 		//
 		//  NOTES
 		//
+		//  On return the colour table describes the pixels remaining in the source frame. When the frame is trimmed the
+		//  counts and extents of the remaining colours are recomputed from the trimmed frame, otherwise only the counts
+		//  and extents of the substitute colour change and these are updated as the pixels are substituted.
+		//
 
 		static void		partitionFrame(Frame<RGB>* pFrame, ColourTable<RGB>& CT, BoundingBox& PExtents) {
 			SizeVector			svTrim = {};													//  Size Vector for trim operations
@@ -2681,6 +2924,10 @@ namespace xymorg {
 
 				//  Adjust the location of the frame on the canvas
 				pFrame->setRRow(pFrame->getRRow() + pRBPart->getHeight());
+
+				//  Recompute the colour table for the trimmed frame
+				CT.clear();
+				countColours(pFrame, CT);
 			}
 			else if (PExtents.Bottom == (pFrame->getHeight() - 1) && PExtents.Left == 0 && PExtents.Right == (pFrame->getWidth() - 1)) {
 				//  Complete rows may be trimmed from the bottom of the image
@@ -2692,6 +2939,10 @@ namespace xymorg {
 
 				//  Trim the source image
 				pFrame->buffer().resize(svTrim, nullptr);
+
+				//  Recompute the colour table for the trimmed frame
+				CT.clear();
+				countColours(pFrame, CT);
 			}
 			else if (PExtents.Left == 0 && PExtents.Top == 0 && PExtents.Bottom == (pFrame->getHeight() - 1)) {
 				//  Complete columns may be trimmed from the left of the image
@@ -2706,6 +2957,10 @@ namespace xymorg {
 
 				//  Adjust the location of the frame on the canvas
 				pFrame->setRCol(pFrame->getRCol() + pRBPart->getWidth());
+
+				//  Recompute the colour table for the trimmed frame
+				CT.clear();
+				countColours(pFrame, CT);
 			}
 			else if (PExtents.Right == (pFrame->getWidth() - 1) && PExtents.Top == 0 && PExtents.Bottom == (pFrame->getHeight() - 1)) {
 				//  Complete columns may be trimmed from the right of the image
@@ -2718,6 +2973,9 @@ namespace xymorg {
 				//  Trim the source image
 				pFrame->buffer().resize(svTrim, nullptr);
 
+				//  Recompute the colour table for the trimmed frame
+				CT.clear();
+				countColours(pFrame, CT);
 			}
 			else {
 
@@ -2726,9 +2984,16 @@ namespace xymorg {
 				isOverlay = true;
 				MostUsed = CT.getMostUsedColour();
 
-				//  Iterate over the partitioned area substituting the most used colour for any partitioned colours
-				for (RasterBuffer<RGB>::iterator It = pFrame->buffer().begin(PExtents); It != pFrame->buffer().end(PExtents); It++) {
-					if (!CT.hasColour(*It)) *It = MostUsed;
+				//  Iterate over the partitioned area substituting the most used colour for any partitioned colours,
+				//  the substituted pixels are accounted to the most used colour
+				for (size_t Row = PExtents.Top; Row <= PExtents.Bottom; Row++) {
+					for (size_t Col = PExtents.Left; Col <= PExtents.Right; Col++) {
+						RGB*	pPixel = pFrame->buffer().getPixel(Row, Col);
+						if (!CT.hasColour(*pPixel)) {
+							*pPixel = MostUsed;
+							CT.add(MostUsed, 1, Row, Col);
+						}
+					}
 				}
 
 				//  Make a pass over the partitioned RasterBuffer assigning a transparent colour to any pixels that are in the source image
@@ -2779,25 +3044,33 @@ namespace xymorg {
 			//  Safety
 			if (NumColours == 0) return 0;
 
+			//  A qualifying partition holds fewer than 256 colours and leaves no more than 256, this is not possible
+			//  when the table holds 512 or more colours
+			if (NumColours >= 512) return NumColours;
+
 			//  Allocate the array of partition entries
 			PTE* pPartTable = new PTE[NumColours];
 			if (pPartTable == nullptr) return NumColours;
 
+			//  Capture the extents of each colour
+			for (CX = 0; CX < NumColours; CX++) pPartTable[CX].Extents = CT.getExtents(CX);
+
 			//  Populate the Partition Table
 			for (CX = 0; CX < NumColours; CX++) {
+				const BoundingBox&	PExt = pPartTable[CX].Extents;										//  Extents of the partition
+
 				//  Fill in the height * width of the partition
-				CCX = CX;
-				pPartTable[CX].H = (CT.getExtents(CCX).Bottom - CT.getExtents(CCX).Top) + 1;
-				pPartTable[CX].W = (CT.getExtents(CCX).Right - CT.getExtents(CCX).Left) + 1;
-				Pixels = pPartTable[CCX].H * pPartTable[CCX].W;
+				pPartTable[CX].H = (PExt.Bottom - PExt.Top) + 1;
+				pPartTable[CX].W = (PExt.Right - PExt.Left) + 1;
+				Pixels = pPartTable[CX].H * pPartTable[CX].W;
 				pPartTable[CX].Pixels = Pixels;
 
 				//  Count the number of wholly contained colour partitions within the current partition (including self)
 				for (CCX = 0; CCX < NumColours; CCX++) {
-					if (CT.getExtents(CCX).Top >= CT.getExtents(CX).Top &&
-						CT.getExtents(CCX).Bottom <= CT.getExtents(CX).Bottom &&
-						CT.getExtents(CCX).Left >= CT.getExtents(CX).Left &&
-						CT.getExtents(CCX).Right <= CT.getExtents(CX).Right) pPartTable[CX].Colours++;
+					if (pPartTable[CCX].Extents.Top >= PExt.Top &&
+						pPartTable[CCX].Extents.Bottom <= PExt.Bottom &&
+						pPartTable[CCX].Extents.Left >= PExt.Left &&
+						pPartTable[CCX].Extents.Right <= PExt.Right) pPartTable[CX].Colours++;
 				}
 
 				//  Set the score for this entry
@@ -2830,29 +3103,29 @@ namespace xymorg {
 
 		//  serialiseTrain
 		//
-		//  This static function will build an in-memory GIF image from the passed CANONICAL Train.
+		//  This static function will write a GIF image of the passed CANONICAL Train to the passed sink.
 		//
 		//  PARAMETERS
 		//
 		//		Train*			-		Pointer to the input Canonical Train
-		//		size_t&			-		Reference to the size of the in-memory image
+		//		ResourceSink&	-		Reference to the sink that receives the image
 		//		SWITCHES		-		Options to use for storing the image
 		//
 		//  RETURNS
 		//
-		//		BYTE*			-		Pointer to the constructed in-memory image
+		//		bool			-		true if the complete image was written to the sink, otherwise false
 		//
 		//  NOTES
 		//
-		//		The input Train MUST be a GIF CANONICAL Train
+		//		1.		The input Train MUST be a GIF CANONICAL Train
+		//		2.		The frame images are built concurrently in batches of two per worker, each batch is written to
+		//				the sink before the next is built so only a batch of frame images is held in memory.
 		//
 
-		static BYTE* serialiseTrain(Train<RGB>* pTrain, size_t& ImgSize, SWITCHES Opts) {
-			BYTE*			pImage = nullptr;													//  Pointer to in-memory image
-			size_t			ImgAlc = 0;															//  Allocated size of the in-memory image
-			size_t			ImgUsed = 0;														//  Bytes used in the in-memory image
+		static bool		serialiseTrain(Train<RGB>* pTrain, ResourceSink& Out, SWITCHES Opts) {
+			BYTE			Header[4096 + (256 * sizeof(RGB))] = {};							//  Header staging buffer
+			size_t			ImgUsed = 0;														//  Bytes used in the staging buffer
 			int				ImageType = 0;														//  GIF Image Type
-			size_t			ImgEst = 0;															//  (Over) Estimated initial size of the image
 			Frame<RGB>*		pFrame = pTrain->getFirstFrame();									//  Pointer to the current frame
 			ColourTable<RGB>			CT;														//  Colour table for the image
 			GIF_ODI_COLOUR_TABLE		GCT = {};												//  Global Colour Table
@@ -2864,15 +3137,6 @@ namespace xymorg {
 			//  If the image is an animation then flag that
 			if (ImageType == GIF_ANIMATION) Opts = Opts | GIF_INT_ANIMATION;					//  Flag an animation being serialised
 
-			//  Allocate space for the complete image (it will auto expand if too small)
-			ImgEst = 4096 + (256 * sizeof(RGB)) + (pTrain->getCanvasHeight() * pTrain->getCanvasWidth());
-			ImgAlc = 0;
-			ImgUsed = 0;
-			pImage = (BYTE*) malloc(ImgEst);
-			if (pImage == nullptr) return nullptr;
-			ImgAlc = ImgEst;
-			memset(pImage, 0, ImgEst);
-
 			//  Images ALWAYS use a Global Colour Table (GCT) for the first frame in the train. Build the GCT
 			//  Add the background colour as the first entry in the table
 			CT.add(pTrain->getBackGround(), 0);
@@ -2895,55 +3159,58 @@ namespace xymorg {
 			for (size_t CX = 0; CX < CT.getNumColours(); CX++) 	GCT.Entry[CX] = CT.getColour(CX);
 
 			//  Append a GIF File Header to the stream
-			appendFileHeader(pImage, ImgUsed);
+			appendFileHeader(Header, ImgUsed);
 
 			//  Append a Logical Screen Descriptor (LSD) to the image
-			appendLSD(pImage, ImgUsed, pTrain->getCanvasHeight(), pTrain->getCanvasWidth(), CT.getNumColours(), 0);
+			appendLSD(Header, ImgUsed, pTrain->getCanvasHeight(), pTrain->getCanvasWidth(), CT.getNumColours(), 0);
 
-			//  Append the Global Colour Table (GCT) to the in-memory image
-			appendColourTable(pImage, ImgUsed, &GCT, CT.getNumColours());
+			//  Append the Global Colour Table (GCT) to the image
+			appendColourTable(Header, ImgUsed, &GCT, CT.getNumColours());
 
 			//  If the image is an Animation then append a Netscape Application Extension Block to set the play iteration counter
-			if (Opts & GIF_INT_ANIMATION) appendNNAXB(pImage, ImgUsed, Opts);
+			if (Opts & GIF_INT_ANIMATION) appendNNAXB(Header, ImgUsed, Opts);
 
-			//  Append the images (GCE, ID, optional LCT, EEB) for each frame
-			pFrame = pTrain->getFirstFrame();
-			while (pFrame != nullptr) {
+			//  Write the headers
+			Out.write(Header, ImgUsed);
 
-				//  Check that we have enough free space in the image memory block for the frame
-				ImgEst = 256 + (256 & sizeof(RGB)) + (pFrame->getHeight() * pFrame->getWidth());
-				if ((ImgAlc - ImgUsed) < ImgEst) {
-					//  Expand the image memory block
-					BYTE* pNewIBfr = (BYTE*) realloc(pImage, ImgAlc + ImgEst);
-					if (pNewIBfr != nullptr) {
-						pImage = pNewIBfr;
-						ImgAlc += ImgEst;
-						memset(pImage + ImgUsed, 0, ImgAlc - ImgUsed);
-					}
-				}
+			//  Build the images (GCE, ID, optional LCT, EEB) for each frame concurrently, each into its own buffer
+			size_t			NumFrames = 0;														//  Number of frames
+			for (pFrame = pTrain->getFirstFrame(); pFrame != nullptr; pFrame = pFrame->getNext()) NumFrames++;
 
-				//  Append the image data
-				appendImage(pImage, ImgUsed, pFrame, CT, Opts);
+			Frame<RGB>**	Frames = new Frame<RGB>*[NumFrames + 1];							//  Frames in the train
+			size_t			Batch = 2 * WorkGang::workers();									//  Frames built per batch
+			BYTE**			FrameImage = new BYTE*[Batch];										//  Image built for each frame (batch)
+			size_t*			FrameUsed = new size_t[Batch];										//  Size of each frame image (batch)
 
-				//  Move on to the next frame
-				pFrame = pFrame->getNext();
-			}
+			NumFrames = 0;
+			for (pFrame = pTrain->getFirstFrame(); pFrame != nullptr; pFrame = pFrame->getNext()) Frames[NumFrames++] = pFrame;
+
+			for (size_t FirstFX = 0; FirstFX < NumFrames; FirstFX += Batch) {
+				size_t			BatchFrames = (NumFrames - FirstFX) < Batch ? (NumFrames - FirstFX) : Batch;	//  Frames in this batch
 
-			//  Append the GIF File Trailer
-			appendFileTrailer(pImage, ImgUsed);
+				WorkGang::run(BatchFrames, [&](size_t BX) {
+					FrameImage[BX] = buildFrameImage(Frames[FirstFX + BX], FrameUsed[BX], CT, Opts);
+				});
 
-			//  Release unused memory in the image block
-			if ((ImgAlc - ImgUsed) > 256) {
-				BYTE* pNewIBfr = (BYTE*) realloc(pImage, ImgUsed);
-				if (pNewIBfr != nullptr) {
-					pImage = pNewIBfr;
-					ImgAlc = ImgUsed;
+				//  Write the frame images of the batch in train order
+				for (size_t BX = 0; BX < BatchFrames; BX++) {
+					if (FrameImage[BX] == nullptr) continue;
+					Out.write(FrameImage[BX], FrameUsed[BX]);
+					free(FrameImage[BX]);
 				}
 			}
 
-			//  Return the in-memory image to the caller
-			ImgSize = ImgUsed;
-			return pImage;
+			delete[] Frames;
+			delete[] FrameImage;
+			delete[] FrameUsed;
+
+			//  Write the GIF File Trailer
+			ImgUsed = 0;
+			appendFileTrailer(Header, ImgUsed);
+			Out.write(Header, ImgUsed);
+
+			//  Return showing if the image was written
+			return !Out.hasFailed();
 		}
 
 		//  appendFileHeader
@@ -3075,6 +3342,48 @@ namespace xymorg {
 			return;
 		}
 
+		//  buildFrameImage
+		//
+		//  This static function will build the image (GCE, ID & EEB) for a single frame in a buffer of its own
+		//
+		//  PARAMETERS
+		//
+		//		Frame*					-		Pointer to the Frame to be built
+		//		size_t&					-		Reference to the size of the built frame image
+		//		CoulourTable&			-		Reference to the Global Colour Table
+		//		SWITCHES				-		Options to use for storing the image
+		//
+		//  RETURNS
+		//
+		//		BYTE*					-		Pointer to the frame image (malloc), nullptr if it could not be built
+		//
+		//  NOTES
+		//
+		//		The Global Colour Table is only read, frames may be built concurrently.
+		//
+
+		static BYTE*	buildFrameImage(Frame<RGB>* pFrame, size_t& FrameUsed, ColourTable<RGB>& GCT, SWITCHES Opts) {
+			size_t		Pixels = pFrame->getHeight() * pFrame->getWidth();								//  Pixels in the frame
+			BYTE*		pFImage = nullptr;																//  Frame image
+
+			//  The LZW codes are at most 12 bits per pixel and each 255 byte sub-block carries a length byte
+			size_t		FrameEst = 256 + (256 * sizeof(RGB)) + ((Pixels * 3) / 2) + (Pixels / 128);
+
+			FrameUsed = 0;
+			pFImage = (BYTE*) calloc(1, FrameEst);
+			if (pFImage == nullptr) return nullptr;
+
+			//  Append the image data
+			appendImage(pFImage, FrameUsed, pFrame, GCT, Opts);
+
+			//  Release the unused space
+			BYTE* pNewFBfr = (BYTE*) realloc(pFImage, FrameUsed);
+			if (pNewFBfr != nullptr) pFImage = pNewFBfr;
+
+			//  Return the frame image
+			return pFImage;
+		}
+
 		//  appendImage
 		//
 		//  This static function will append an image (GCE, ID & EEB) 
@@ -3300,6 +3609,7 @@ namespace xymorg {
 
 			//  Signal end of the image stream to the collector
 			ImgIn.signalEndOfStream();
+			if (Encoder.getTokenCount() == 0) std::cerr << "ERROR: The GIF image encoder could not allocate the LZW dictionary, image data has not been stored." << std::endl;
 
 			//  Copy the segmented stream generated to the EEB
 			memcpy(&pEEB->segment, bsOut.getBufferAddress(), bsOut.getBytesWritten());
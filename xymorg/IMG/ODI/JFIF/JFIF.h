@@ -40,6 +40,7 @@
 #include	"../../Train.h"																			//  Image Train
 #include	"../../ColourTable.h"																	//  Colour Table (array)
 #include	"../../CODECS/Huffman.h"																//  Base Huffman CODEC
+#include	"../../../MP/WorkGang.h"																//  Worker gang
 
 namespace xymorg {
 
@@ -58,6 +59,22 @@ namespace xymorg {
 
 		//  Options for storing images
 		static const SWITCHES	JFIF_STORE_OPT_HIFI = 1;										//  High Fidelity Image 1x1 sampling
+		static const SWITCHES	JFIF_STORE_OPT_FDCT_FLOAT = 2;									//  Use the floating-point FDCT engine
+		static const SWITCHES	JFIF_STORE_OPT_FDCT_REFERENCE = 4;								//  Use the reference (direct) FDCT
+		static const SWITCHES	JFIF_STORE_OPT_RESTART = 8;										//  Emit restart intervals (strips encoded concurrently)
+		static const SWITCHES	JFIF_STORE_OPT_OPTIMISE = 16;									//  Two pass encoding with optimised Huffman tables
+		static const int		JFIF_STORE_RESTART_ROWS_SHIFT = 8;								//  Options bits 8-15 hold MCU rows per interval (0 = 1)
+		static const int		JFIF_STORE_QUALITY_SHIFT = 16;									//  Options bits 16-23 hold the quality 1-100 (0 = default tables)
+
+		//  Options for loading images
+		static const SWITCHES	JFIF_LOAD_OPT_IDCT_FLOAT = 1;									//  Use the floating-point IDCT engine
+		static const SWITCHES	JFIF_LOAD_OPT_IDCT_REFERENCE = 2;								//  Use the reference (direct) IDCT
+		static const SWITCHES	JFIF_LOAD_OPT_FANCY_UPSAMPLING = 4;								//  Triangular (smooth) chroma upsampling
+		static const SWITCHES	JFIF_LOAD_OPT_SCALE_1_2 = 8;									//  Decode at 1/2 scale (4x4 IDCT)
+		static const SWITCHES	JFIF_LOAD_OPT_SCALE_1_4 = 16;									//  Decode at 1/4 scale (2x2 IDCT)
+		static const SWITCHES	JFIF_LOAD_OPT_SCALE_1_8 = 24;									//  Decode at 1/8 scale (DC only)
+		static const SWITCHES	JFIF_LOAD_OPT_SCALE_MASK = 24;									//  Mask for the scale selection
+		static const SWITCHES	JFIF_LOAD_OPT_PROGRESSIVE_PREVIEW = 32;							//  Stop a progressive frame after the DC scan(s)
 
 	private:
 
@@ -85,6 +102,43 @@ namespace xymorg {
 			DU				DUCr[4];											//  Cr-Channel
 		} MCU;
 
+		//  Component sample planes of a decoded scan, each component is held at its own sampling resolution
+		typedef struct CPLANES {
+			size_t			Height;												//  Scan Height (MCU aligned)
+			size_t			Width;												//  Scan Width (MCU aligned)
+			BYTE			MCUFF;												//  MCU Form Factor
+			size_t			DUSize;												//  Samples per side of a decoded DU (8 unless scaled)
+			size_t			MCUCols;											//  MCUs in each row of the scan
+			BoundingBox		MCUReg;												//  Region of the scan held in the planes (MCUs)
+			int				HSF[3];												//  Horizontal Sampling Factor (by component)
+			int				VSF[3];												//  Vertical Sampling Factor (by component)
+			size_t			CDUSize[3];											//  Samples per side of a decoded DU (by component)
+			size_t			PH[3];												//  Plane Height (by component)
+			size_t			PW[3];												//  Plane Width (by component)
+			BYTE*			Plane[3];											//  Samples (by component, row major)
+		} CPLANES;
+
+		//  Quantized coefficients of a progressive frame, the DUs of each component are held in MCU order
+		typedef struct COEFFS {
+			size_t			MCUCols;											//  MCUs in each row of the frame
+			size_t			MCURows;											//  MCU rows in the frame
+			int				HSF[3];												//  Horizontal Sampling Factor (by component)
+			int				VSF[3];												//  Vertical Sampling Factor (by component)
+			size_t			BW[3];												//  DUs in each row of a single component scan
+			size_t			BH[3];												//  DU rows in a single component scan
+			DU*				pDUs[3];											//  DUs (by component)
+		} COEFFS;
+
+		//  Source image for encoding, the image is extended to complete MCUs by repeating the last row and column
+		typedef struct JSOURCE {
+			RasterBuffer<RGB>*	pRB;											//  Source pixels (flattened canvas)
+			size_t			Height;												//  Image Height
+			size_t			Width;												//  Image Width
+			size_t			ScanH;												//  Scan Height (MCU aligned)
+			size_t			ScanW;												//  Scan Width (MCU aligned)
+			BYTE			MCUFF;												//  MCU Form Factor
+		} JSOURCE;
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Private Nested Classes                                                                                        *
@@ -138,6 +192,9 @@ namespace xymorg {
 					for (vIndex = 0; vIndex < 64; vIndex++) QTable[vIndex] = GetSizeBE(pQV16->QV[vIndex].PV);
 				}
 
+				//  Build the folded (AAN scaled) reciprocals in natural order
+				buildReciprocals();
+
 				//  Return to caller
 				return;
 			}
@@ -176,8 +233,8 @@ namespace xymorg {
 			void quantize(DU& duIn) const {
 				int			tIndex = 0;																//  Index into the quantization table
 
-				duIn.DC = (duIn.DC + (QTable[0] / 2)) / QTable[0];
-				for (tIndex = 0; tIndex < 63; tIndex++) duIn.AC[tIndex] = (duIn.AC[tIndex] + (QTable[tIndex] / 2)) / QTable[tIndex];
+				duIn.DC = divide(duIn.DC, QTable[0]);
+				for (tIndex = 0; tIndex < 63; tIndex++) duIn.AC[tIndex] = divide(duIn.AC[tIndex], QTable[tIndex + 1]);
 
 				//  Return to caller
 				return;
@@ -203,8 +260,8 @@ namespace xymorg {
 				int			tIndex = 0;															//  Index into the quantization table
 				DU			QDU = {};															//  Quantized Data Unit
 
-				QDU.DC = (pDUIn->DC + (QTable[0] / 2)) / QTable[0];
-				for (tIndex = 0; tIndex < 63; tIndex++) QDU.AC[tIndex] = (pDUIn->AC[tIndex] + (QTable[tIndex] / 2)) / QTable[tIndex];
+				QDU.DC = divide(pDUIn->DC, QTable[0]);
+				for (tIndex = 0; tIndex < 63; tIndex++) QDU.AC[tIndex] = divide(pDUIn->AC[tIndex], QTable[tIndex + 1]);
 
 				//  Return the quantized Data Unit
 				return QDU;
@@ -228,7 +285,7 @@ namespace xymorg {
 				int			tIndex = 0;															//  Index into the quantization table
 
 				duIn.DC = duIn.DC * QTable[0];
-				for (tIndex = 0; tIndex < 63; tIndex++) duIn.AC[tIndex] = duIn.AC[tIndex] * QTable[tIndex];
+				for (tIndex = 0; tIndex < 63; tIndex++) duIn.AC[tIndex] = duIn.AC[tIndex] * QTable[tIndex + 1];
 
 				//  Return to caller
 				return;
@@ -255,12 +312,74 @@ namespace xymorg {
 				DU			DQDU = {};																//  Dequantized Data Unit
 
 				DQDU.DC = pDUIn->DC * QTable[0];
-				for (tIndex = 0; tIndex < 63; tIndex++) DQDU.AC[tIndex] = pDUIn->AC[tIndex] * QTable[tIndex];
+				for (tIndex = 0; tIndex < 63; tIndex++) DQDU.AC[tIndex] = pDUIn->AC[tIndex] * QTable[tIndex + 1];
 
 				//  Return the dequantized Data Unit
 				return DQDU;
 			}
 
+			//  quantizeAAN
+			//
+			//  Quantizes the output of a floating-point AAN forward DCT into the output DU
+			//
+			//  PARAMETERS
+			//
+			//		float*			-		Pointer to the 64 AAN scaled coefficients (natural order)
+			//		DU&				-		Reference to the output Data Unit (natural order)
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//  The AAN output scaling and the quantization divisor are combined in a single reciprocal so that each
+			//  coefficient is quantized with one multiply.
+			//
+
+			void quantizeAAN(const float* pCoeff, DU& duOut) const {
+				float		Value = 0.0f;																//  Scaled value
+
+				for (int nIndex = 0; nIndex < 64; nIndex++) {
+					Value = pCoeff[nIndex] * FRecip[nIndex];
+					if (Value >= 0.0f) Value += 0.5f;
+					else Value -= 0.5f;
+					if (nIndex == 0) duOut.DC = int16_t(Value);
+					else duOut.AC[nIndex - 1] = int16_t(Value);
+				}
+
+				//  Return to caller
+				return;
+			}
+
+			//  quantizeAAN
+			//
+			//  Quantizes the output of a scaled-integer AAN forward DCT into the output DU
+			//
+			//  PARAMETERS
+			//
+			//		int*			-		Pointer to the 64 AAN scaled coefficients (natural order)
+			//		DU&				-		Reference to the output Data Unit (natural order)
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//  The reciprocals carry a 24 bit fraction, rounding is symmetric about zero.
+			//
+
+			void quantizeAAN(const int* pCoeff, DU& duOut) const {
+				int			Value = 0;																	//  Scaled value
+
+				for (int nIndex = 0; nIndex < 64; nIndex++) {
+					if (pCoeff[nIndex] >= 0) Value = int(((uint64_t(pCoeff[nIndex]) * IRecip[nIndex]) + (uint64_t(1) << 23)) >> 24);
+					else Value = -int(((uint64_t(-pCoeff[nIndex]) * IRecip[nIndex]) + (uint64_t(1) << 23)) >> 24);
+					if (nIndex == 0) duOut.DC = int16_t(Value);
+					else duOut.AC[nIndex - 1] = int16_t(Value);
+				}
+
+				//  Return to caller
+				return;
+			}
+
 			//  serialize
 			//
 			//  Serializes the quanisation table in JPEG format, including the leading Precision and Destination encoding BYTE
@@ -320,7 +439,80 @@ namespace xymorg {
 			//*																													*
 			//*******************************************************************************************************************
 
-			uint16_t			QTable[64];														//  Quantization table values
+			uint16_t			QTable[64];														//  Quantization table values (zig-zag order)
+			float				FRecip[64];														//  Float AAN folded reciprocals (natural order)
+			uint32_t			IRecip[64];														//  Integer AAN folded reciprocals (natural order)
+
+			//*******************************************************************************************************************
+			//*																													*
+			//*  Private Functions																								*
+			//*																													*
+			//*******************************************************************************************************************
+
+			//  buildReciprocals
+			//
+			//  Builds the natural order reciprocal tables used to quantize the output of the AAN forward DCT engines
+			//
+			//  PARAMETERS
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//  The AAN transforms leave each output scaled by 8 * S(u) * S(v) where S(0) = 1 and S(k) = cos(k*Pi/16) * sqrt(2),
+			//  that scaling is folded into the divisor for each position.
+			//
+
+			void buildReciprocals() {
+				const int		ZZ[64] = { 0, 1, 8, 16, 9, 2, 3, 10,
+											17, 24, 32, 25, 18, 11, 4, 5,
+											12, 19, 26, 33, 40, 48, 41, 34,
+											27, 20, 13, 6, 7, 14, 21, 28,
+											35, 42, 49, 56, 57, 50, 43, 36,
+											29, 22, 15, 23, 30, 37, 44, 51,
+											58, 59, 52, 45, 38, 31, 39, 46,
+											53, 60, 61, 54, 47, 55, 62, 63 };					//  Zig-Zag position to natural position
+				double			AAN[8] = {};														//  AAN scale factors
+				double			Divisor = 0.0;														//  Folded divisor
+
+				for (int kIndex = 0; kIndex < 8; kIndex++) {
+					if (kIndex == 0) AAN[kIndex] = 1.0;
+					else AAN[kIndex] = cos((double(kIndex) * Pi) / 16.0) * sqrt(2.0);
+				}
+
+				for (int zIndex = 0; zIndex < 64; zIndex++) {
+					int		nIndex = ZZ[zIndex];
+					Divisor = double(QTable[zIndex] == 0 ? 1 : QTable[zIndex]) * AAN[nIndex >> 3] * AAN[nIndex & 7] * 8.0;
+					FRecip[nIndex] = float(1.0 / Divisor);
+					IRecip[nIndex] = uint32_t(floor((double(uint32_t(1) << 24) / Divisor) + 0.5));
+				}
+
+				//  Return to caller
+				return;
+			}
+
+			//  divide
+			//
+			//  Divides the passed coefficient by the quantization value, rounding to the nearest integer
+			//
+			//  PARAMETERS
+			//
+			//		int				-		Coefficient
+			//		int				-		Quantization value
+			//
+			//  RETURNS
+			//
+			//		int16_t			-		Quantized coefficient
+			//
+			//  NOTES
+			//
+			//  Rounding is symmetric about zero.
+			//
+
+			static int16_t divide(int Coefficient, int QValue) {
+				if (Coefficient >= 0) return int16_t((Coefficient + (QValue / 2)) / QValue);
+				return int16_t(-((-Coefficient + (QValue / 2)) / QValue));
+			}
 		};
 
 		//*******************************************************************************************************************
@@ -341,6 +533,19 @@ namespace xymorg {
 			//*                                                                                                                 *
 			//*******************************************************************************************************************
 
+		public:
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Public Constants                                                                                              *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  Inverse DCT engines
+			static const int	IDCT_ENGINE_INTEGER = 0;											//  Separable fixed-point (LLM) transform
+			static const int	IDCT_ENGINE_FLOAT = 1;												//  Separable floating-point (AAN) transform
+			static const int	IDCT_ENGINE_REFERENCE = 2;											//  Direct 2-D transform (accuracy reference)
+
 		private:
 
 			//*******************************************************************************************************************
@@ -379,6 +584,9 @@ namespace xymorg {
 					DCTree = nullptr;
 					ACTree = nullptr;
 					Input = nullptr;
+					pReplay[0] = nullptr;
+					pReplay[1] = nullptr;
+					pReplay[2] = nullptr;
 
 					//  Clear the previous DC values
 					PreviousDC[0] = 0;
@@ -419,6 +627,7 @@ namespace xymorg {
 				//
 
 				bool hasNext() {
+					if (Input == nullptr) return true;
 					return !Input->eos();
 				}
 
@@ -438,11 +647,18 @@ namespace xymorg {
 				//	NOTES:
 				// 
 				//  The caller must have set the DC & AC HuffmanTree addreses for he current channel prior to making this call.
+				//  When there is no Input the DU is replayed from the coefficient buffer of the channel.
 				//
 
 				DU nextDU(int Channel) {
 					int			acIndex;															//  Index into the AC array
 
+					//  Replay the next DU of the channel, the DC value is absolute
+					if (Input == nullptr) {
+						DUCount++;
+						return *pReplay[Channel]++;
+					}
+
 					//  Clear the DU
 					memset(&NewDU, 0, sizeof(DU));
 
@@ -483,9 +699,11 @@ namespace xymorg {
 
 				//  Configuration Functions
 
-				void setDCHuffmanTree(Huffman::HuffmanTree* NewDCTree) { DCTree = NewDCTree; DCTree->setCurrentNode(nullptr); return; }
-				void setACHuffmanTree(Huffman::HuffmanTree* NewACTree) { ACTree = NewACTree; ACTree->setCurrentNode(nullptr); return; }
+				//  Trees are shared by concurrently decoded restart intervals, decoders keep their own position in the tree
+				void setDCHuffmanTree(Huffman::HuffmanTree* NewDCTree) { DCTree = NewDCTree; return; }
+				void setACHuffmanTree(Huffman::HuffmanTree* NewACTree) { ACTree = NewACTree; return; }
 				void setInput(Huffman::JPEGEmitter* NewEmitter) { Input = NewEmitter; return; }
+				void setReplay(const DU* const* pNewDUs) { for (int CX = 0; CX < 3; CX++) pReplay[CX] = pNewDUs[CX]; return; }
 
 			private:
 
@@ -503,6 +721,7 @@ namespace xymorg {
 
 				//  Input Object
 				Huffman::JPEGEmitter*			Input;												//  Source emitter
+				const DU*						pReplay[3];											//  Next DU to replay (per channel)
 
 				//  DC & AC HuffmanTree objects
 				Huffman::HuffmanTree*			DCTree;												//  DC Huffman Tree
@@ -807,6 +1026,20 @@ namespace xymorg {
 					Q = nullptr;
 					Input = nullptr;
 
+					//  Default to the fixed-point engine at full size
+					Engine = IDCT_ENGINE_INTEGER;
+					OutputSize[0] = 8;
+					OutputSize[1] = 8;
+					OutputSize[2] = 8;
+					Discard = false;
+
+					//  Build the AAN input scaling table, this includes the final division by 8 of the 2-D transform
+					for (int rIndex = 0; rIndex < 8; rIndex++) {
+						for (int cIndex = 0; cIndex < 8; cIndex++) {
+							AANScale[(rIndex * 8) + cIndex] = float((AANFactor(rIndex) * AANFactor(cIndex)) / 8.0);
+						}
+					}
+
 					//  Return to caller
 					return;
 				}
@@ -855,8 +1088,6 @@ namespace xymorg {
 
 				DU nextDU(int Channel) {
 					DU			InputDU;
-					uint16_t	yIndex, xIndex, uIndex, vIndex;																		//  Cell indexes
-					double		Coefficient, Sample, Element, Accumulator;															//  Working calculation variables
 
 					//  Clear the DU
 					memset(&NewDU, 0, sizeof(DU));
@@ -869,40 +1100,30 @@ namespace xymorg {
 					//  Read the Next DU from the Builder
 					InputDU = Input->nextDU(Channel);
 
-					//
-					//  Apply the Inverse DCT transform
-					//
-					//  Convert each coefficient in the Data unit in turn
-					for (yIndex = 0; yIndex < 8; yIndex++)
-					{
-						for (xIndex = 0; xIndex < 8; xIndex++)
-						{
-							//  Perform the inverse DCT transform
-							Accumulator = 0.0;
-							for (uIndex = 0; uIndex < 8; uIndex++)
-							{
-								for (vIndex = 0; vIndex < 8; vIndex++)
-								{
-									if (uIndex == 0) Element = 1.0 / sqrt(2);
-									else Element = 1.0;
-									if (vIndex == 0) Element = Element * (1.0 / sqrt(2));
+					//  A discarded DU is only decoded to keep the entropy decoder in step
+					if (Discard) return NewDU;
 
-									if (uIndex == 0 && vIndex == 0) Coefficient = double(InputDU.DC);
-									else Coefficient = double(InputDU.AC[((vIndex * 8) + uIndex) - 1]);
+					//  Reduced size outputs use the scaled transforms whatever the selected engine
+					if (OutputSize[Channel] < 8) {
+						if (OutputSize[Channel] == 4) invert4x4(InputDU);
+						else if (OutputSize[Channel] == 2) invert2x2(InputDU);
+						else storeSample(0, descale(clampCoefficient(InputDU.DC), 3));
+						return NewDU;
+					}
 
-									Element = Element * Coefficient;
-									Element = Element * cos(((((2.0 * double(xIndex)) + 1.0) * double(uIndex)) * Pi) / 16.0);
-									Element = Element * cos(((((2.0 * double(yIndex)) + 1.0) * double(vIndex)) * Pi) / 16.0);
-									Accumulator += Element;
-								}
-							}
+					//  Apply the Inverse DCT transform using the selected engine
+					switch (Engine) {
+					case IDCT_ENGINE_FLOAT:
+						invertFloat(InputDU);
+						break;
 
-							Sample = Accumulator / 4.0;
+					case IDCT_ENGINE_REFERENCE:
+						invertReference(InputDU);
+						break;
 
-							//  Output the result
-							if (yIndex == 0 && xIndex == 0) NewDU.DC = uint16_t(Sample);
-							else NewDU.AC[((yIndex * 8) + xIndex) - 1] = uint16_t(Sample);
-						}
+					default:
+						invertInteger(InputDU);
+						break;
 					}
 
 					//  Return the DU
@@ -915,9 +1136,49 @@ namespace xymorg {
 				void setACHuffmanTree(Huffman::HuffmanTree* NewACTree) { ACTree = NewACTree; return; }
 				void setQuantizer(JPEGQuantizer* NewQ) { Q = NewQ; return; }
 				void setInput(Unzigzagger* NewUZZ) { Input = NewUZZ; return; }
+				void setEngine(int NewEngine) { Engine = NewEngine; return; }
+				void setOutputSize(int Channel, int NewSize) { OutputSize[Channel] = NewSize; return; }
+				void setDiscard(bool NewDiscard) { Discard = NewDiscard; return; }
 
 			private:
 
+				//*******************************************************************************************************************
+				//*																													*
+				//*  Private Constants																								*
+				//*																													*
+				//*******************************************************************************************************************
+
+				//  Fixed-point (13 bit fraction) rotation constants for the integer engine
+				static const int	IFIX_0_298631336 = 2446;
+				static const int	IFIX_0_390180644 = 3196;
+				static const int	IFIX_0_541196100 = 4433;
+				static const int	IFIX_0_765366865 = 6270;
+				static const int	IFIX_0_899976223 = 7373;
+				static const int	IFIX_1_175875602 = 9633;
+				static const int	IFIX_1_501321110 = 12299;
+				static const int	IFIX_1_847759065 = 15137;
+				static const int	IFIX_1_961570560 = 16069;
+				static const int	IFIX_2_053119869 = 16819;
+				static const int	IFIX_2_562915447 = 20995;
+				static const int	IFIX_3_072711026 = 25172;
+
+				//  Additional constants for the reduced size transforms
+				static const int	IFIX_0_211164243 = 1730;
+				static const int	IFIX_0_509795579 = 4176;
+				static const int	IFIX_0_601344887 = 4926;
+				static const int	IFIX_0_720959822 = 5906;
+				static const int	IFIX_0_850430095 = 6967;
+				static const int	IFIX_1_061594337 = 8697;
+				static const int	IFIX_1_272758580 = 10426;
+				static const int	IFIX_1_451774981 = 11893;
+				static const int	IFIX_2_172734803 = 17799;
+				static const int	IFIX_3_624509785 = 29692;
+
+				static const int	CONST_BITS = 13;												//  Fraction bits in the constants
+				static const int	PASS1_BITS = 2;													//  Extra precision carried between passes
+				static const int	COEFF_MIN = -2048;												//  Lowest legal dequantized coefficient (12 bit)
+				static const int	COEFF_MAX = 2047;												//  Highest legal dequantized coefficient (12 bit)
+
 				//*******************************************************************************************************************
 				//*																													*
 				//*  Private Members																								*
@@ -935,180 +1196,661 @@ namespace xymorg {
 				Huffman::HuffmanTree*			ACTree;												//  AC Huffman Tree
 				JPEGQuantizer*					Q;													//  Quantizer
 
-			};
-
-			//*******************************************************************************************************************
-			//*                                                                                                                 *
-			//*   Upshifter Class																								*
-			//*                                                                                                                 *
-			//*   The Upshifter class reads the next available DU from the DCTInverrter and applies the up shift to the DU		*
-			//*   Coefficients, which are now Y, Cb or Cr channel values.														*
-			//*                                                                                                                 *
-			//*                                                                                                                 *
-			//*******************************************************************************************************************
-
-			class Upshifter {
-			public:
+				//  Transform engine
+				int								Engine;												//  Selected IDCT engine
+				int								OutputSize[3];										//  Samples per side of the output (8, 4, 2 or 1 by channel)
+				bool							Discard;											//  Skip the transform (DU is not required)
+				float							AANScale[64];										//  AAN input scaling (natural order)
 
 				//*******************************************************************************************************************
-				//*                                                                                                                 *
-				//*   Constructors                                                                                                  *
-				//*                                                                                                                 *
+				//*																													*
+				//*  Private Functions																								*
+				//*																													*
 				//*******************************************************************************************************************
 
-				//  Default Constructor
+				//  AANFactor
+				//
+				//  Returns the AAN scale factor for the passed frequency index
+				//
+				//  PARAMETERS:
+				//
+				//		int				-		Frequency index (0 - 7)
+				//
+				//  RETURNS:
+				//
+				//      double			-		Scale factor, 1 for index 0 otherwise cos(k*Pi/16) * sqrt(2)
+				//
+				//	NOTES:
+				//
 
-				Upshifter() {
-					//  Clear the DU
-					memset(&NewDU, 0, sizeof(DU));
+				static double AANFactor(int Index) {
+					if (Index == 0) return 1.0;
+					return cos((double(Index) * Pi) / 16.0) * sqrt(2.0);
+				}
 
-					//  Clear the tables
-					DCTree = nullptr;
-					ACTree = nullptr;
-					Q = nullptr;
-					Input = nullptr;
-					Precision = 0;
+				//  loadCoefficients
+				//
+				//  Unpacks the passed DU into a natural order array of 64 coefficients
+				//
+				//  PARAMETERS:
+				//
+				//		DU&				-		Reference to the input DU
+				//		int*			-		Pointer to the 64 entry coefficient array
+				//
+				//  RETURNS:
+				//
+				//	NOTES:
+				//
+				//  The coefficients are clamped to the legal 12 bit range for 8 bit samples, a corrupt stream can otherwise
+				//  present arbitrary 16 bit values to the transforms.
+				//
 
-					DURead[0] = 0;
-					DURead[1] = 0;
-					DURead[2] = 0;
+				static void loadCoefficients(DU& InputDU, int* Coeff) {
+					Coeff[0] = clampCoefficient(InputDU.DC);
+					for (int acIndex = 0; acIndex < 63; acIndex++) Coeff[acIndex + 1] = clampCoefficient(InputDU.AC[acIndex]);
 
 					//  Return to caller
 					return;
 				}
 
-				//*******************************************************************************************************************
-				//*                                                                                                                 *
-				//*   Public Functions                                                                                              *
-				//*                                                                                                                 *
-				//*******************************************************************************************************************
-
-				//  hasNext
+				//  clampCoefficient
 				//
-				//  Determines if more data is available from the pipeline
+				//  Limits the passed dequantized coefficient to the legal range
 				//
 				//  PARAMETERS:
 				//
+				//		int				-		Coefficient value
+				//
 				//  RETURNS:
 				//
-				//      bool				-		true if more data is available, otherwise false
+				//      int				-		The coefficient clamped to COEFF_MIN - COEFF_MAX
 				//
 				//	NOTES:
-				// 
 				//
 
-				bool hasNext() {
-					return Input->hasNext();
+				static int clampCoefficient(int Value) {
+					if (Value < COEFF_MIN) return COEFF_MIN;
+					if (Value > COEFF_MAX) return COEFF_MAX;
+					return Value;
 				}
 
-				//  nextDU
+				//  storeSample
 				//
-				//  Retrieves the decoded DU from the entropy encoded stream, applies the differential coding to the DC value
-				//  and returns the completed DU.
+				//  Stores the passed sample into the output DU at the given natural order position
 				//
 				//  PARAMETERS:
 				//
-				//		int				-		Channel Number being read
+				//		int				-		Position in the DU (0 - 63)
+				//		int				-		Sample value
 				//
 				//  RETURNS:
 				//
-				//      DU				-		The completed Data Unit (DU)
-				//
 				//	NOTES:
-				// 
-				//  The caller must have set the DC & AC HuffmanTree and JPEGQuantizer addreses for he current channel prior to making this call.
 				//
 
-				DU nextDU(int Channel) {
-					uint16_t			acIndex;
-					uint16_t			Shift = 1 << (Precision - 1);																//  Shift level
+				void storeSample(int Pos, int Sample) {
+					if (Pos == 0) NewDU.DC = int16_t(Sample);
+					else NewDU.AC[Pos - 1] = int16_t(Sample);
 
-					//  Clear the DU
-					memset(&NewDU, 0, sizeof(DU));
+					//  Return to caller
+					return;
+				}
 
-					//  Set the DC and AC Tree in the DU Builder
-					Input->setDCHuffmanTree(DCTree);
-					Input->setACHuffmanTree(ACTree);
-					Input->setQuantizer(Q);
+				//  invertInteger
+				//
+				//  Applies the inverse DCT to the passed DU using the separable fixed-point engine
+				//
+				//  PARAMETERS:
+				//
+				//		DU&				-		Reference to the input DU (natural order coefficients)
+				//
+				//  RETURNS:
+				//
+				//	NOTES:
+				//
+				//  The transform is the Loeffler, Ligtenberg & Moschytz 1-D IDCT (12 multiplies) applied first to the columns
+				//  and then to the rows, with 13 bit fixed-point constants. Intermediate results carry PASS1_BITS of extra
+				//  precision, the outputs are rounded to the nearest integer.
+				//
 
-					//  Read the next DU from the pipeline
-					NewDU = Input->nextDU(Channel);
-					DURead[Channel]++;
+				void invertInteger(DU& InputDU) {
+					int			Coeff[64];																			//  Natural order coefficients
+					int			WS[64];																				//  Workspace (column pass output)
+					int64_t		tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13;									//  Even part working
+					int64_t		z1, z2, z3, z4, z5;																	//  Odd part working
+					int*		pIn = nullptr;																		//  Current input
+					int*		pWS = nullptr;																		//  Current workspace
 
-					//  Shift and clamp the DC
-					NewDU.DC += Shift;
-					if (NewDU.DC < 0) NewDU.DC = 0;
-					if (NewDU.DC > 255) NewDU.DC = 255;
+					loadCoefficients(InputDU, Coeff);
 
-					//  Shift and clamp the AC coefficients
-					for (acIndex = 0; acIndex < 63; acIndex++) {
-						NewDU.AC[acIndex] += Shift;
-						if (NewDU.AC[acIndex] < 0) NewDU.AC[acIndex] = 0;
-						if (NewDU.AC[acIndex] > 255) NewDU.AC[acIndex] = 255;
-					}
+					//  Pass 1: process the columns, storing the (scaled up) results in the workspace
+					for (int cIndex = 0; cIndex < 8; cIndex++) {
+						pIn = Coeff + cIndex;
+						pWS = WS + cIndex;
 
-					//  Return the updated DU
-					return NewDU;
-				}
+						//  Short-cut for columns with no AC terms, the result is the (scaled) DC term throughout
+						if (pIn[8] == 0 && pIn[16] == 0 && pIn[24] == 0 && pIn[32] == 0 && pIn[40] == 0 && pIn[48] == 0 && pIn[56] == 0) {
+							int	DCVal = pIn[0] * (1 << PASS1_BITS);
+							for (int rIndex = 0; rIndex < 8; rIndex++) pWS[rIndex * 8] = DCVal;
+							continue;
+						}
 
-				//  Configuration Functions
+						//  Even part
+						z2 = pIn[16];
+						z3 = pIn[48];
+						z1 = (z2 + z3) * IFIX_0_541196100;
+						tmp2 = z1 - (z3 * IFIX_1_847759065);
+						tmp3 = z1 + (z2 * IFIX_0_765366865);
+
+						tmp0 = (pIn[0] + pIn[32]) * (1 << CONST_BITS);
+						tmp1 = (pIn[0] - pIn[32]) * (1 << CONST_BITS);
+
+						tmp10 = tmp0 + tmp3;
+						tmp13 = tmp0 - tmp3;
+						tmp11 = tmp1 + tmp2;
+						tmp12 = tmp1 - tmp2;
+
+						//  Odd part
+						tmp0 = pIn[56];
+						tmp1 = pIn[40];
+						tmp2 = pIn[24];
+						tmp3 = pIn[8];
+
+						z1 = tmp0 + tmp3;
+						z2 = tmp1 + tmp2;
+						z3 = tmp0 + tmp2;
+						z4 = tmp1 + tmp3;
+						z5 = (z3 + z4) * IFIX_1_175875602;
+
+						tmp0 = tmp0 * IFIX_0_298631336;
+						tmp1 = tmp1 * IFIX_2_053119869;
+						tmp2 = tmp2 * IFIX_3_072711026;
+						tmp3 = tmp3 * IFIX_1_501321110;
+						z1 = -z1 * IFIX_0_899976223;
+						z2 = -z2 * IFIX_2_562915447;
+						z3 = (-z3 * IFIX_1_961570560) + z5;
+						z4 = (-z4 * IFIX_0_390180644) + z5;
+
+						tmp0 += z1 + z3;
+						tmp1 += z2 + z4;
+						tmp2 += z2 + z3;
+						tmp3 += z1 + z4;
+
+						//  Final output stage
+						pWS[0] = descale(tmp10 + tmp3, CONST_BITS - PASS1_BITS);
+						pWS[56] = descale(tmp10 - tmp3, CONST_BITS - PASS1_BITS);
+						pWS[8] = descale(tmp11 + tmp2, CONST_BITS - PASS1_BITS);
+						pWS[48] = descale(tmp11 - tmp2, CONST_BITS - PASS1_BITS);
+						pWS[16] = descale(tmp12 + tmp1, CONST_BITS - PASS1_BITS);
+						pWS[40] = descale(tmp12 - tmp1, CONST_BITS - PASS1_BITS);
+						pWS[24] = descale(tmp13 + tmp0, CONST_BITS - PASS1_BITS);
+						pWS[32] = descale(tmp13 - tmp0, CONST_BITS - PASS1_BITS);
+					}
 
-				void setDCHuffmanTree(Huffman::HuffmanTree* NewDCTree) { DCTree = NewDCTree; return; }
-				void setACHuffmanTree(Huffman::HuffmanTree* NewACTree) { ACTree = NewACTree; return; }
-				void setQuantizer(JPEGQuantizer* NewQ) { Q = NewQ; return; }
-				void setInput(DCTInverter* NewInverter) { Input = NewInverter; return; }
-				void setPrecision(int NewPrecision) { Precision = NewPrecision; return; }
+					//  Pass 2: process the rows from the workspace, removing the pass 1 scaling and the factor of 8
+					for (int rIndex = 0; rIndex < 8; rIndex++) {
+						pWS = WS + (rIndex * 8);
 
-			private:
+						//  Short-cut for rows with no AC terms
+						if (pWS[1] == 0 && pWS[2] == 0 && pWS[3] == 0 && pWS[4] == 0 && pWS[5] == 0 && pWS[6] == 0 && pWS[7] == 0) {
+							int	DCVal = descale(pWS[0], PASS1_BITS + 3);
+							for (int cIndex = 0; cIndex < 8; cIndex++) storeSample((rIndex * 8) + cIndex, DCVal);
+							continue;
+						}
 
-				//*******************************************************************************************************************
-				//*																													*
-				//*  Private Members																								*
-				//*																													*
-				//*******************************************************************************************************************
+						//  Even part
+						z2 = pWS[2];
+						z3 = pWS[6];
+						z1 = (z2 + z3) * IFIX_0_541196100;
+						tmp2 = z1 - (z3 * IFIX_1_847759065);
+						tmp3 = z1 + (z2 * IFIX_0_765366865);
+
+						tmp0 = (pWS[0] + pWS[4]) * (1 << CONST_BITS);
+						tmp1 = (pWS[0] - pWS[4]) * (1 << CONST_BITS);
+
+						tmp10 = tmp0 + tmp3;
+						tmp13 = tmp0 - tmp3;
+						tmp11 = tmp1 + tmp2;
+						tmp12 = tmp1 - tmp2;
+
+						//  Odd part
+						tmp0 = pWS[7];
+						tmp1 = pWS[5];
+						tmp2 = pWS[3];
+						tmp3 = pWS[1];
+
+						z1 = tmp0 + tmp3;
+						z2 = tmp1 + tmp2;
+						z3 = tmp0 + tmp2;
+						z4 = tmp1 + tmp3;
+						z5 = (z3 + z4) * IFIX_1_175875602;
+
+						tmp0 = tmp0 * IFIX_0_298631336;
+						tmp1 = tmp1 * IFIX_2_053119869;
+						tmp2 = tmp2 * IFIX_3_072711026;
+						tmp3 = tmp3 * IFIX_1_501321110;
+						z1 = -z1 * IFIX_0_899976223;
+						z2 = -z2 * IFIX_2_562915447;
+						z3 = (-z3 * IFIX_1_961570560) + z5;
+						z4 = (-z4 * IFIX_0_390180644) + z5;
+
+						tmp0 += z1 + z3;
+						tmp1 += z2 + z4;
+						tmp2 += z2 + z3;
+						tmp3 += z1 + z4;
+
+						//  Final output stage
+						storeSample((rIndex * 8) + 0, descale(tmp10 + tmp3, CONST_BITS + PASS1_BITS + 3));
+						storeSample((rIndex * 8) + 7, descale(tmp10 - tmp3, CONST_BITS + PASS1_BITS + 3));
+						storeSample((rIndex * 8) + 1, descale(tmp11 + tmp2, CONST_BITS + PASS1_BITS + 3));
+						storeSample((rIndex * 8) + 6, descale(tmp11 - tmp2, CONST_BITS + PASS1_BITS + 3));
+						storeSample((rIndex * 8) + 2, descale(tmp12 + tmp1, CONST_BITS + PASS1_BITS + 3));
+						storeSample((rIndex * 8) + 5, descale(tmp12 - tmp1, CONST_BITS + PASS1_BITS + 3));
+						storeSample((rIndex * 8) + 3, descale(tmp13 + tmp0, CONST_BITS + PASS1_BITS + 3));
+						storeSample((rIndex * 8) + 4, descale(tmp13 - tmp0, CONST_BITS + PASS1_BITS + 3));
+					}
 
-				//  Data Unit
-				DU								NewDU;
+					//  Return to caller
+					return;
+				}
 
-				//  Input Object
-				DCTInverter*					Input;												//  Source emitter
+				//  invert4x4
+				//
+				//  Applies a reduced size inverse DCT to the passed DU producing a 4x4 block of samples
+				//
+				//  PARAMETERS:
+				//
+				//		DU&				-		Reference to the input DU (natural order coefficients)
+				//
+				//  RETURNS:
+				//
+				//	NOTES:
+				//
+				//  Each output sample is the average of a 2x2 block of the full size transform, this has no dependency on
+				//  the coefficients in row or column 4 which are ignored. The samples are stored row major in the first
+				//  16 positions of the output DU.
+				//
 
-				//  DC & AC HuffmanTree & JPEGQuantizer objects
-				Huffman::HuffmanTree*			DCTree;												//  DC Huffman Tree
-				Huffman::HuffmanTree*			ACTree;												//  AC Huffman Tree
-				JPEGQuantizer*					Q;													//  Quantizer
+				void invert4x4(DU& InputDU) {
+					int			Coeff[64];																			//  Natural order coefficients
+					int			WS[32];																				//  Workspace (column pass output)
+					int64_t		tmp0, tmp2, tmp10, tmp12;															//  Working values
+					int64_t		z1, z2, z3, z4;																		//  Odd part inputs
+					int*		pIn = nullptr;																		//  Current input
+					int*		pWS = nullptr;																		//  Current workspace
 
-				//  Precision
-				int								Precision;											//  Precision (current frame)
+					loadCoefficients(InputDU, Coeff);
 
-				//  Instrumentation
-				size_t							DURead[3];
+					//  Pass 1: process the columns, storing the (scaled up) results in the workspace
+					for (int cIndex = 0; cIndex < 8; cIndex++) {
+						if (cIndex == 4) continue;
+						pIn = Coeff + cIndex;
+						pWS = WS + cIndex;
+
+						//  Short-cut for columns with no (relevant) AC terms
+						if (pIn[8] == 0 && pIn[16] == 0 && pIn[24] == 0 && pIn[40] == 0 && pIn[48] == 0 && pIn[56] == 0) {
+							int	DCVal = pIn[0] * (1 << PASS1_BITS);
+							for (int rIndex = 0; rIndex < 4; rIndex++) pWS[rIndex * 8] = DCVal;
+							continue;
+						}
+
+						//  Even part
+						tmp0 = pIn[0] * (1 << (CONST_BITS + 1));
+						tmp2 = (pIn[16] * IFIX_1_847759065) - (pIn[48] * IFIX_0_765366865);
+						tmp10 = tmp0 + tmp2;
+						tmp12 = tmp0 - tmp2;
+
+						//  Odd part
+						z1 = pIn[56];
+						z2 = pIn[40];
+						z3 = pIn[24];
+						z4 = pIn[8];
+						tmp0 = -(z1 * IFIX_0_211164243) + (z2 * IFIX_1_451774981) - (z3 * IFIX_2_172734803) + (z4 * IFIX_1_061594337);
+						tmp2 = -(z1 * IFIX_0_509795579) - (z2 * IFIX_0_601344887) + (z3 * IFIX_0_899976223) + (z4 * IFIX_2_562915447);
+
+						//  Final output stage
+						pWS[0] = descale(tmp10 + tmp2, CONST_BITS - PASS1_BITS + 1);
+						pWS[24] = descale(tmp10 - tmp2, CONST_BITS - PASS1_BITS + 1);
+						pWS[8] = descale(tmp12 + tmp0, CONST_BITS - PASS1_BITS + 1);
+						pWS[16] = descale(tmp12 - tmp0, CONST_BITS - PASS1_BITS + 1);
+					}
+
+					//  Pass 2: process the 4 rows from the workspace, removing the pass 1 scaling and the factor of 8
+					for (int rIndex = 0; rIndex < 4; rIndex++) {
+						pWS = WS + (rIndex * 8);
+
+						//  Short-cut for rows with no (relevant) AC terms
+						if (pWS[1] == 0 && pWS[2] == 0 && pWS[3] == 0 && pWS[5] == 0 && pWS[6] == 0 && pWS[7] == 0) {
+							int	DCVal = descale(pWS[0], PASS1_BITS + 3);
+							for (int cIndex = 0; cIndex < 4; cIndex++) storeSample((rIndex * 4) + cIndex, DCVal);
+							continue;
+						}
+
+						//  Even part
+						tmp0 = pWS[0] * (1 << (CONST_BITS + 1));
+						tmp2 = (pWS[2] * IFIX_1_847759065) - (pWS[6] * IFIX_0_765366865);
+						tmp10 = tmp0 + tmp2;
+						tmp12 = tmp0 - tmp2;
+
+						//  Odd part
+						z1 = pWS[7];
+						z2 = pWS[5];
+						z3 = pWS[3];
+						z4 = pWS[1];
+						tmp0 = -(z1 * IFIX_0_211164243) + (z2 * IFIX_1_451774981) - (z3 * IFIX_2_172734803) + (z4 * IFIX_1_061594337);
+						tmp2 = -(z1 * IFIX_0_509795579) - (z2 * IFIX_0_601344887) + (z3 * IFIX_0_899976223) + (z4 * IFIX_2_562915447);
+
+						//  Final output stage
+						storeSample((rIndex * 4) + 0, descale(tmp10 + tmp2, CONST_BITS + PASS1_BITS + 3 + 1));
+						storeSample((rIndex * 4) + 3, descale(tmp10 - tmp2, CONST_BITS + PASS1_BITS + 3 + 1));
+						storeSample((rIndex * 4) + 1, descale(tmp12 + tmp0, CONST_BITS + PASS1_BITS + 3 + 1));
+						storeSample((rIndex * 4) + 2, descale(tmp12 - tmp0, CONST_BITS + PASS1_BITS + 3 + 1));
+					}
+
+					//  Return to caller
+					return;
+				}
+
+				//  invert2x2
+				//
+				//  Applies a reduced size inverse DCT to the passed DU producing a 2x2 block of samples
+				//
+				//  PARAMETERS:
+				//
+				//		DU&				-		Reference to the input DU (natural order coefficients)
+				//
+				//  RETURNS:
+				//
+				//	NOTES:
+				//
+				//  Each output sample is the average of a 4x4 block of the full size transform, only the DC and the odd
+				//  frequencies contribute. The samples are stored row major in the first 4 positions of the output DU.
+				//
+
+				void invert2x2(DU& InputDU) {
+					int			Coeff[64];																			//  Natural order coefficients
+					int			WS[16];																				//  Workspace (column pass output)
+					int64_t		tmp0, tmp10;																		//  Working values
+					int*		pIn = nullptr;																		//  Current input
+					int*		pWS = nullptr;																		//  Current workspace
+
+					loadCoefficients(InputDU, Coeff);
+
+					//  Pass 1: process the columns that contribute, storing the (scaled up) results in the workspace
+					for (int cIndex = 0; cIndex < 8; cIndex++) {
+						if (cIndex == 2 || cIndex == 4 || cIndex == 6) continue;
+						pIn = Coeff + cIndex;
+						pWS = WS + cIndex;
+
+						//  Short-cut for columns with no (relevant) AC terms
+						if (pIn[8] == 0 && pIn[24] == 0 && pIn[40] == 0 && pIn[56] == 0) {
+							int	DCVal = pIn[0] * (1 << PASS1_BITS);
+							pWS[0] = DCVal;
+							pWS[8] = DCVal;
+							continue;
+						}
+
+						//  Even part
+						tmp10 = pIn[0] * (1 << (CONST_BITS + 2));
+
+						//  Odd part
+						tmp0 = -(pIn[56] * IFIX_0_720959822) + (pIn[40] * IFIX_0_850430095) - (pIn[24] * IFIX_1_272758580) + (pIn[8] * IFIX_3_624509785);
+
+						//  Final output stage
+						pWS[0] = descale(tmp10 + tmp0, CONST_BITS - PASS1_BITS + 2);
+						pWS[8] = descale(tmp10 - tmp0, CONST_BITS - PASS1_BITS + 2);
+					}
+
+					//  Pass 2: process the 2 rows from the workspace, removing the pass 1 scaling and the factor of 8
+					for (int rIndex = 0; rIndex < 2; rIndex++) {
+						pWS = WS + (rIndex * 8);
+
+						//  Even part
+						tmp10 = pWS[0] * (1 << (CONST_BITS + 2));
+
+						//  Odd part
+						tmp0 = -(pWS[7] * IFIX_0_720959822) + (pWS[5] * IFIX_0_850430095) - (pWS[3] * IFIX_1_272758580) + (pWS[1] * IFIX_3_624509785);
+
+						//  Final output stage
+						storeSample((rIndex * 2) + 0, descale(tmp10 + tmp0, CONST_BITS + PASS1_BITS + 3 + 2));
+						storeSample((rIndex * 2) + 1, descale(tmp10 - tmp0, CONST_BITS + PASS1_BITS + 3 + 2));
+					}
+
+					//  Return to caller
+					return;
+				}
+
+				//  descale
+				//
+				//  Right shifts the passed fixed-point value with rounding
+				//
+				//  PARAMETERS:
+				//
+				//		int64_t			-		Value to descale
+				//		int				-		Number of bits to shift
+				//
+				//  RETURNS:
+				//
+				//      int				-		The descaled value
+				//
+				//	NOTES:
+				//
+				//  The fixed-point engines carry 64 bit intermediates, the clamped inputs bound the descaled results well
+				//  within an int.
+				//
+
+				static int descale(int64_t Value, int Bits) {
+					return int((Value + (int64_t(1) << (Bits - 1))) >> Bits);
+				}
+
+				//  invertFloat
+				//
+				//  Applies the inverse DCT to the passed DU using the separable floating-point engine
+				//
+				//  PARAMETERS:
+				//
+				//		DU&				-		Reference to the input DU (natural order coefficients)
+				//
+				//  RETURNS:
+				//
+				//	NOTES:
+				//
+				//  The transform is the Arai, Agui & Nakajima 1-D IDCT (5 multiplies) applied first to the columns and then
+				//  to the rows. The AAN output scaling is folded into the input coefficients through the precomputed
+				//  AANScale table, the outputs are rounded to the nearest integer.
+				//
+
+				void invertFloat(DU& InputDU) {
+					int			Coeff[64];																			//  Natural order coefficients
+					float		WS[64];																				//  Workspace (column pass output)
+					float		tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;										//  Working values
+					float		tmp10, tmp11, tmp12, tmp13;															//  Even part working
+					float		z5, z10, z11, z12, z13;																//  Odd part working
+					float*		pWS = nullptr;																		//  Current workspace
+
+					loadCoefficients(InputDU, Coeff);
+
+					//  Pass 1: process the columns, storing the results in the workspace
+					for (int cIndex = 0; cIndex < 8; cIndex++) {
+						int*		pIn = Coeff + cIndex;
+						float*		pQS = AANScale + cIndex;
+						pWS = WS + cIndex;
+
+						//  Short-cut for columns with no AC terms
+						if (pIn[8] == 0 && pIn[16] == 0 && pIn[24] == 0 && pIn[32] == 0 && pIn[40] == 0 && pIn[48] == 0 && pIn[56] == 0) {
+							float	DCVal = float(pIn[0]) * pQS[0];
+							for (int rIndex = 0; rIndex < 8; rIndex++) pWS[rIndex * 8] = DCVal;
+							continue;
+						}
+
+						//  Even part
+						tmp0 = float(pIn[0]) * pQS[0];
+						tmp1 = float(pIn[16]) * pQS[16];
+						tmp2 = float(pIn[32]) * pQS[32];
+						tmp3 = float(pIn[48]) * pQS[48];
+
+						tmp10 = tmp0 + tmp2;
+						tmp11 = tmp0 - tmp2;
+						tmp13 = tmp1 + tmp3;
+						tmp12 = ((tmp1 - tmp3) * 1.414213562f) - tmp13;
+
+						tmp0 = tmp10 + tmp13;
+						tmp3 = tmp10 - tmp13;
+						tmp1 = tmp11 + tmp12;
+						tmp2 = tmp11 - tmp12;
+
+						//  Odd part
+						tmp4 = float(pIn[8]) * pQS[8];
+						tmp5 = float(pIn[24]) * pQS[24];
+						tmp6 = float(pIn[40]) * pQS[40];
+						tmp7 = float(pIn[56]) * pQS[56];
+
+						z13 = tmp6 + tmp5;
+						z10 = tmp6 - tmp5;
+						z11 = tmp4 + tmp7;
+						z12 = tmp4 - tmp7;
+
+						tmp7 = z11 + z13;
+						tmp11 = (z11 - z13) * 1.414213562f;
+						z5 = (z10 + z12) * 1.847759065f;
+						tmp10 = (z12 * 1.082392200f) - z5;
+						tmp12 = (z10 * -2.613125930f) + z5;
+
+						tmp6 = tmp12 - tmp7;
+						tmp5 = tmp11 - tmp6;
+						tmp4 = tmp10 + tmp5;
+
+						//  Final output stage
+						pWS[0] = tmp0 + tmp7;
+						pWS[56] = tmp0 - tmp7;
+						pWS[8] = tmp1 + tmp6;
+						pWS[48] = tmp1 - tmp6;
+						pWS[16] = tmp2 + tmp5;
+						pWS[40] = tmp2 - tmp5;
+						pWS[32] = tmp3 + tmp4;
+						pWS[24] = tmp3 - tmp4;
+					}
+
+					//  Pass 2: process the rows from the workspace
+					for (int rIndex = 0; rIndex < 8; rIndex++) {
+						pWS = WS + (rIndex * 8);
+
+						//  Even part
+						tmp10 = pWS[0] + pWS[4];
+						tmp11 = pWS[0] - pWS[4];
+						tmp13 = pWS[2] + pWS[6];
+						tmp12 = ((pWS[2] - pWS[6]) * 1.414213562f) - tmp13;
+
+						tmp0 = tmp10 + tmp13;
+						tmp3 = tmp10 - tmp13;
+						tmp1 = tmp11 + tmp12;
+						tmp2 = tmp11 - tmp12;
+
+						//  Odd part
+						z13 = pWS[5] + pWS[3];
+						z10 = pWS[5] - pWS[3];
+						z11 = pWS[1] + pWS[7];
+						z12 = pWS[1] - pWS[7];
+
+						tmp7 = z11 + z13;
+						tmp11 = (z11 - z13) * 1.414213562f;
+						z5 = (z10 + z12) * 1.847759065f;
+						tmp10 = (z12 * 1.082392200f) - z5;
+						tmp12 = (z10 * -2.613125930f) + z5;
+
+						tmp6 = tmp12 - tmp7;
+						tmp5 = tmp11 - tmp6;
+						tmp4 = tmp10 + tmp5;
+
+						//  Final output stage
+						storeSample((rIndex * 8) + 0, int(lroundf(tmp0 + tmp7)));
+						storeSample((rIndex * 8) + 7, int(lroundf(tmp0 - tmp7)));
+						storeSample((rIndex * 8) + 1, int(lroundf(tmp1 + tmp6)));
+						storeSample((rIndex * 8) + 6, int(lroundf(tmp1 - tmp6)));
+						storeSample((rIndex * 8) + 2, int(lroundf(tmp2 + tmp5)));
+						storeSample((rIndex * 8) + 5, int(lroundf(tmp2 - tmp5)));
+						storeSample((rIndex * 8) + 4, int(lroundf(tmp3 + tmp4)));
+						storeSample((rIndex * 8) + 3, int(lroundf(tmp3 - tmp4)));
+					}
+
+					//  Return to caller
+					return;
+				}
+
+				//  invertReference
+				//
+				//  Applies the inverse DCT to the passed DU by direct evaluation of the 2-D transform
+				//
+				//  PARAMETERS:
+				//
+				//		DU&				-		Reference to the input DU (natural order coefficients)
+				//
+				//  RETURNS:
+				//
+				//	NOTES:
+				//
+				//  This is the original O(n^4) implementation, it is retained as the accuracy reference for the fast engines.
+				//
+
+				void invertReference(DU& InputDU) {
+					uint16_t	yIndex, xIndex, uIndex, vIndex;																		//  Cell indexes
+					double		Coefficient, Sample, Element, Accumulator;															//  Working calculation variables
+
+					//
+					//  Apply the Inverse DCT transform
+					//
+					//  Convert each coefficient in the Data unit in turn
+					for (yIndex = 0; yIndex < 8; yIndex++)
+					{
+						for (xIndex = 0; xIndex < 8; xIndex++)
+						{
+							//  Perform the inverse DCT transform
+							Accumulator = 0.0;
+							for (uIndex = 0; uIndex < 8; uIndex++)
+							{
+								for (vIndex = 0; vIndex < 8; vIndex++)
+								{
+									if (uIndex == 0) Element = 1.0 / sqrt(2);
+									else Element = 1.0;
+									if (vIndex == 0) Element = Element * (1.0 / sqrt(2));
+
+									if (uIndex == 0 && vIndex == 0) Coefficient = double(InputDU.DC);
+									else Coefficient = double(InputDU.AC[((vIndex * 8) + uIndex) - 1]);
+
+									Element = Element * Coefficient;
+									Element = Element * cos(((((2.0 * double(xIndex)) + 1.0) * double(uIndex)) * Pi) / 16.0);
+									Element = Element * cos(((((2.0 * double(yIndex)) + 1.0) * double(vIndex)) * Pi) / 16.0);
+									Accumulator += Element;
+								}
+							}
+
+							Sample = Accumulator / 4.0;
+
+							//  Output the result
+							if (yIndex == 0 && xIndex == 0) NewDU.DC = uint16_t(Sample);
+							else NewDU.AC[((yIndex * 8) + xIndex) - 1] = uint16_t(Sample);
+						}
+					}
+
+					//  Return to caller
+					return;
+				}
 
 			};
 
 			//*******************************************************************************************************************
 			//*                                                                                                                 *
-			//*   CMCUBuilder Class																								*
+			//*   Upshifter Class																								*
 			//*                                                                                                                 *
-			//*   The CMCUBuilder class A complete CMCU from the DUs obtained from the pipeline.								*
+			//*   The Upshifter class reads the next available DU from the DCTInverrter and applies the up shift to the DU		*
+			//*   Coefficients, which are now Y, Cb or Cr channel values.														*
 			//*                                                                                                                 *
 			//*                                                                                                                 *
 			//*******************************************************************************************************************
 
-			class CMCUBuilder {
+			class Upshifter {
 			public:
 
-				//*******************************************************************************************************************
-				//*                                                                                                                 *
-				//*   Local Definitions		                                                                                        *
-				//*                                                                                                                 *
-				//*******************************************************************************************************************
-
-				//  SDU structure overlays a DU providing a normalised spatial access to the coefficients
-				typedef struct SDU {
-					uint16_t			C[64];														//  Coefficients
-				} SDU;
-
 				//*******************************************************************************************************************
 				//*                                                                                                                 *
 				//*   Constructors                                                                                                  *
@@ -1117,16 +1859,23 @@ namespace xymorg {
 
 				//  Default Constructor
 
-				CMCUBuilder() {
+				Upshifter() {
 					//  Clear the DU
-					memset(&NewCMCU, 0, sizeof(CMCU));
-					MCUFF = 0x22;
+					memset(&NewDU, 0, sizeof(DU));
 
 					//  Clear the tables
 					DCTree = nullptr;
 					ACTree = nullptr;
 					Q = nullptr;
 					Input = nullptr;
+					Precision = 0;
+					Samples[0] = 64;
+					Samples[1] = 64;
+					Samples[2] = 64;
+
+					DURead[0] = 0;
+					DURead[1] = 0;
+					DURead[2] = 0;
 
 					//  Return to caller
 					return;
@@ -1156,56 +1905,54 @@ namespace xymorg {
 					return Input->hasNext();
 				}
 
-				//  nextCMCU
+				//  nextDU
 				//
-				//  Retrieves the decoded DUs from the pipeline and populates then returnd the MCU
+				//  Retrieves the decoded DU from the entropy encoded stream, applies the differential coding to the DC value
+				//  and returns the completed DU.
 				//
 				//  PARAMETERS:
 				//
 				//		int				-		Channel Number being read
-				//		int				-		Horizontal Sampling Factor
-				//		int				-		Vertical Sampling factor
 				//
 				//  RETURNS:
 				//
-				//      CMCU				-		The completed Sincle Channel Minimum Coding Unit (CMCU)
+				//      DU				-		The completed Data Unit (DU)
 				//
 				//	NOTES:
 				// 
 				//  The caller must have set the DC & AC HuffmanTree and JPEGQuantizer addreses for he current channel prior to making this call.
 				//
 
-				CMCU nextCMCU(int Channel, int HSF, int VSF) {
+				DU nextDU(int Channel) {
+					uint16_t			acIndex;
+					uint16_t			Shift = 1 << (Precision - 1);																//  Shift level
 
-					//  Clear the MCU
-					memset(&NewCMCU, 0, sizeof(CMCU));
+					//  Clear the DU
+					memset(&NewDU, 0, sizeof(DU));
 
 					//  Set the DC and AC Tree in the DU Builder
 					Input->setDCHuffmanTree(DCTree);
 					Input->setACHuffmanTree(ACTree);
 					Input->setQuantizer(Q);
 
-					//  Read or copy each DU in turn
-					//  Start with the top left DU, this is always read from the pipeline
-					NewCMCU.CDU[0] = Input->nextDU(Channel);
+					//  Read the next DU from the pipeline
+					NewDU = Input->nextDU(Channel);
+					DURead[Channel]++;
 
-					//  If the horizontal sampling factor is 2 then read the next horizontal otherwise upsample the previous entry
-					if (HSF == 2) NewCMCU.CDU[1] = Input->nextDU(Channel);
-					else upsampleHorizontal(0, 1);
+					//  Shift and clamp the DC
+					NewDU.DC += Shift;
+					if (NewDU.DC < 0) NewDU.DC = 0;
+					if (NewDU.DC > 255) NewDU.DC = 255;
 
-					//  If the Vertical sampling factor is 2 then read the next vertical otherwise copy it
-					if (VSF == 2) {
-						NewCMCU.CDU[2] = Input->nextDU(Channel);
-						if (HSF == 2) NewCMCU.CDU[3] = Input->nextDU(Channel);
-						else upsampleHorizontal(2, 3);
-					}
-					else {
-						upsampleVertical(0, 2);
-						upsampleVertical(1, 3);
+					//  Shift and clamp the remaining samples
+					for (acIndex = 0; acIndex < Samples[Channel] - 1; acIndex++) {
+						NewDU.AC[acIndex] += Shift;
+						if (NewDU.AC[acIndex] < 0) NewDU.AC[acIndex] = 0;
+						if (NewDU.AC[acIndex] > 255) NewDU.AC[acIndex] = 255;
 					}
 
-					//  Return the assembled CMCU
-					return NewCMCU;
+					//  Return the updated DU
+					return NewDU;
 				}
 
 				//  Configuration Functions
@@ -1213,8 +1960,9 @@ namespace xymorg {
 				void setDCHuffmanTree(Huffman::HuffmanTree* NewDCTree) { DCTree = NewDCTree; return; }
 				void setACHuffmanTree(Huffman::HuffmanTree* NewACTree) { ACTree = NewACTree; return; }
 				void setQuantizer(JPEGQuantizer* NewQ) { Q = NewQ; return; }
-				void setInput(Upshifter* NewShifter) { Input = NewShifter; return; }
-				void setMCUFF(BYTE NewFormFactor) { MCUFF = NewFormFactor; }
+				void setInput(DCTInverter* NewInverter) { Input = NewInverter; return; }
+				void setPrecision(int NewPrecision) { Precision = NewPrecision; return; }
+				void setOutputSize(int Channel, int NewSize) { Samples[Channel] = uint16_t(NewSize * NewSize); return; }
 
 			private:
 
@@ -1224,23 +1972,196 @@ namespace xymorg {
 				//*																													*
 				//*******************************************************************************************************************
 
-				//  Minimum Coding Unit (CMCU) - Single Channel
-				CMCU							NewCMCU;
-				BYTE							MCUFF;												//  MCU Form Factor
+				//  Data Unit
+				DU								NewDU;
 
 				//  Input Object
-				Upshifter*						Input;												//  Source emitter
+				DCTInverter*					Input;												//  Source emitter
 
 				//  DC & AC HuffmanTree & JPEGQuantizer objects
 				Huffman::HuffmanTree*			DCTree;												//  DC Huffman Tree
 				Huffman::HuffmanTree*			ACTree;												//  AC Huffman Tree
 				JPEGQuantizer*					Q;													//  Quantizer
 
-				//*******************************************************************************************************************
-				//*                                                                                                                 *
-				//*   Private Functions                                                                                             *
-				//*                                                                                                                 *
-				//*******************************************************************************************************************
+				//  Precision
+				int								Precision;											//  Precision (current frame)
+				uint16_t						Samples[3];											//  Samples in each DU (64 unless scaled, by channel)
+
+				//  Instrumentation
+				size_t							DURead[3];
+
+			};
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   CMCUBuilder Class																								*
+			//*                                                                                                                 *
+			//*   The CMCUBuilder class A complete CMCU from the DUs obtained from the pipeline.								*
+			//*                                                                                                                 *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			class CMCUBuilder {
+			public:
+
+				//*******************************************************************************************************************
+				//*                                                                                                                 *
+				//*   Local Definitions		                                                                                        *
+				//*                                                                                                                 *
+				//*******************************************************************************************************************
+
+				//  SDU structure overlays a DU providing a normalised spatial access to the coefficients
+				typedef struct SDU {
+					uint16_t			C[64];														//  Coefficients
+				} SDU;
+
+				//*******************************************************************************************************************
+				//*                                                                                                                 *
+				//*   Constructors                                                                                                  *
+				//*                                                                                                                 *
+				//*******************************************************************************************************************
+
+				//  Default Constructor
+
+				CMCUBuilder() {
+					//  Clear the DU
+					memset(&NewCMCU, 0, sizeof(CMCU));
+					MCUFF = 0x22;
+					Upsample = true;
+
+					//  Clear the tables
+					DCTree = nullptr;
+					ACTree = nullptr;
+					Q = nullptr;
+					Input = nullptr;
+
+					//  Return to caller
+					return;
+				}
+
+				//*******************************************************************************************************************
+				//*                                                                                                                 *
+				//*   Public Functions                                                                                              *
+				//*                                                                                                                 *
+				//*******************************************************************************************************************
+
+				//  hasNext
+				//
+				//  Determines if more data is available from the pipeline
+				//
+				//  PARAMETERS:
+				//
+				//  RETURNS:
+				//
+				//      bool				-		true if more data is available, otherwise false
+				//
+				//	NOTES:
+				// 
+				//
+
+				bool hasNext() {
+					return Input->hasNext();
+				}
+
+				//  nextCMCU
+				//
+				//  Retrieves the decoded DUs from the pipeline and populates then returnd the MCU
+				//
+				//  PARAMETERS:
+				//
+				//		int				-		Channel Number being read
+				//		int				-		Horizontal Sampling Factor
+				//		int				-		Vertical Sampling factor
+				//
+				//  RETURNS:
+				//
+				//      CMCU				-		The completed Sincle Channel Minimum Coding Unit (CMCU)
+				//
+				//	NOTES:
+				// 
+				//  The caller must have set the DC & AC HuffmanTree and JPEGQuantizer addreses for he current channel prior to making this call.
+				//  When upsampling is off the DUs are returned as decoded, DU (v, h) of the channel is in CDU[(v * 2) + h] and
+				//  the positions beyond the channel sampling factors are left clear.
+				//
+
+				CMCU nextCMCU(int Channel, int HSF, int VSF) {
+
+					//  Clear the MCU
+					memset(&NewCMCU, 0, sizeof(CMCU));
+
+					//  Set the DC and AC Tree in the DU Builder
+					Input->setDCHuffmanTree(DCTree);
+					Input->setACHuffmanTree(ACTree);
+					Input->setQuantizer(Q);
+
+					//  Read or copy each DU in turn
+					//  Start with the top left DU, this is always read from the pipeline
+					NewCMCU.CDU[0] = Input->nextDU(Channel);
+
+					//  At native resolution only the DUs that are present in the stream are read
+					if (!Upsample) {
+						if (HSF == 2) NewCMCU.CDU[1] = Input->nextDU(Channel);
+						if (VSF == 2) {
+							NewCMCU.CDU[2] = Input->nextDU(Channel);
+							if (HSF == 2) NewCMCU.CDU[3] = Input->nextDU(Channel);
+						}
+						return NewCMCU;
+					}
+
+					//  If the horizontal sampling factor is 2 then read the next horizontal otherwise upsample the previous entry
+					if (HSF == 2) NewCMCU.CDU[1] = Input->nextDU(Channel);
+					else upsampleHorizontal(0, 1);
+
+					//  If the Vertical sampling factor is 2 then read the next vertical otherwise copy it
+					if (VSF == 2) {
+						NewCMCU.CDU[2] = Input->nextDU(Channel);
+						if (HSF == 2) NewCMCU.CDU[3] = Input->nextDU(Channel);
+						else upsampleHorizontal(2, 3);
+					}
+					else {
+						upsampleVertical(0, 2);
+						upsampleVertical(1, 3);
+					}
+
+					//  Return the assembled CMCU
+					return NewCMCU;
+				}
+
+				//  Configuration Functions
+
+				void setDCHuffmanTree(Huffman::HuffmanTree* NewDCTree) { DCTree = NewDCTree; return; }
+				void setACHuffmanTree(Huffman::HuffmanTree* NewACTree) { ACTree = NewACTree; return; }
+				void setQuantizer(JPEGQuantizer* NewQ) { Q = NewQ; return; }
+				void setInput(Upshifter* NewShifter) { Input = NewShifter; return; }
+				void setMCUFF(BYTE NewFormFactor) { MCUFF = NewFormFactor; }
+				void setUpsampling(bool NewUpsample) { Upsample = NewUpsample; return; }
+
+			private:
+
+				//*******************************************************************************************************************
+				//*																													*
+				//*  Private Members																								*
+				//*																													*
+				//*******************************************************************************************************************
+
+				//  Minimum Coding Unit (CMCU) - Single Channel
+				CMCU							NewCMCU;
+				BYTE							MCUFF;												//  MCU Form Factor
+				bool							Upsample;											//  Expand subsampled channels to full MCU
+
+				//  Input Object
+				Upshifter*						Input;												//  Source emitter
+
+				//  DC & AC HuffmanTree & JPEGQuantizer objects
+				Huffman::HuffmanTree*			DCTree;												//  DC Huffman Tree
+				Huffman::HuffmanTree*			ACTree;												//  AC Huffman Tree
+				JPEGQuantizer*					Q;													//  Quantizer
+
+				//*******************************************************************************************************************
+				//*                                                                                                                 *
+				//*   Private Functions                                                                                             *
+				//*                                                                                                                 *
+				//*******************************************************************************************************************
 
 				//  upsampleHorizontal
 				//
@@ -1338,7 +2259,7 @@ namespace xymorg {
 					//  Clear the tables
 					DCTree[0] = nullptr;
 					DCTree[1] = nullptr;
-					DCTree[1] = nullptr;
+					DCTree[2] = nullptr;
 					ACTree[0] = nullptr;
 					ACTree[1] = nullptr;
 					ACTree[2] = nullptr;
@@ -1714,6 +2635,35 @@ namespace xymorg {
 					return Pixel;
 				}
 
+				//  nextMCU
+				//
+				//  Returns (emits) the next complete MCU from the pipeline as planar DUs
+				//
+				//  PARAMETERS
+				//
+				//		MCU&					-		Reference to the MCU to receive the decoded samples
+				//
+				//  RETURNS
+				//
+				//		bool					-		true if an MCU was returned, false if the input is exhausted
+				//
+				//  NOTES
+				//
+				//  The sample for row r, column c of the MCU is in DU ((r / 8) * 2) + (c / 8) at (natural) position
+				//  ((r % 8) * 8) + (c % 8). If upsampling is off in the pipeline the subsampled channels are NOT expanded,
+				//  see CMCUBuilder::nextCMCU(). MUST NOT be mixed with calls to next() on the same Emitter.
+				//
+
+				bool nextMCU(MCU& Tile) {
+
+					if (!Input->hasNext()) return false;
+					Tile = Input->nextMCU();
+					MCURead++;
+
+					//  Return to caller
+					return true;
+				}
+
 			private:
 
 				//*******************************************************************************************************************
@@ -1774,6 +2724,10 @@ namespace xymorg {
 			void		setVSPM(int Channel, int Samples) { MCUB.setVSF(Samples, Channel); return; }
 			void		setPrecision(int Precision) { DUUS.setPrecision(Precision); return; }
 			void		setMCUFF(BYTE NewFormFactor) { MCUFF = NewFormFactor; MCUB.setMCUFF(NewFormFactor); return; }
+			void		setIDCTEngine(int NewEngine) { IDCT.setEngine(NewEngine); return; }
+			void		setIDCTOutputSize(int Channel, int NewSize) { IDCT.setOutputSize(Channel, NewSize); DUUS.setOutputSize(Channel, NewSize); return; }
+			void		setDiscard(bool NewDiscard) { IDCT.setDiscard(NewDiscard); return; }
+			void		setUpsampling(bool NewUpsample) { CMCUB.setUpsampling(NewUpsample); return; }
 
 			//  decode
 			//
@@ -1808,6 +2762,34 @@ namespace xymorg {
 				return Emitter(&MCUB, MCUFF);
 			}
 
+			//  replay
+			//
+			//  Connects the start of the decoding pipeline to buffers of previously decoded (quantized) DUs
+			//
+			//  PARAMETERS
+			//
+			//		DU**						-			Const pointer to the array of pointers to the first DU of each channel
+			//
+			//  RETURNS
+			//
+			//		JPEGEmitter					-			The Emitter that emits the output from the pieline
+			//
+			//  NOTES
+			//
+			//	The DUs of each channel must be held in the sequence that they are consumed by the MCUs (zig-zag order
+			//  with absolute DC values). The configuration is as for decode() except that no Huffman Trees are needed.
+			//
+
+			Emitter		replay(const DU* const* pDUs) {
+
+				//  Connect the coefficient buffers to the start of the pipeline
+				DUB.setInput(nullptr);
+				DUB.setReplay(pDUs);
+
+				//  Return the output Emitter - connected to the end of the pipeline
+				return Emitter(&MCUB, MCUFF);
+			}
+
 		private:
 
 			//*******************************************************************************************************************
@@ -1843,6 +2825,17 @@ namespace xymorg {
 		class EncoderPipeline {
 		public:
 
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Public Constants                                                                                              *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  Forward DCT engines
+			static const int	FDCT_ENGINE_INTEGER = 0;											//  Separable scaled-integer (AAN) transform
+			static const int	FDCT_ENGINE_FLOAT = 1;												//  Separable floating-point (AAN) transform
+			static const int	FDCT_ENGINE_REFERENCE = 2;											//  Direct 2-D transform (accuracy reference)
+
 			//*******************************************************************************************************************
 			//*                                                                                                                 *
 			//*   Constructors                                                                                                  *
@@ -1872,6 +2865,12 @@ namespace xymorg {
 				QDU.setOutput(&SDU);
 
 				MCUFF = 0x22;
+				setFDCTEngine(FDCT_ENGINE_INTEGER);
+
+				for (int CX = 0; CX < 3; CX++) {
+					DCTree[CX] = ACTree[CX] = nullptr;
+					HSF[CX] = VSF[CX] = 1;
+				}
 
 				//  Return to caller
 				return;
@@ -1927,6 +2926,7 @@ namespace xymorg {
 					COEmitted = 0;
 
 					Output = nullptr;
+					pStore = nullptr;
 
 					//  Return to caller
 					return;
@@ -1943,6 +2943,7 @@ namespace xymorg {
 				void setDCHuffmanTree(Huffman::HuffmanTree* NewDCTree) { DCTree = NewDCTree; return; }
 				void setACHuffmanTree(Huffman::HuffmanTree* NewACTree) { ACTree = NewACTree; return; }
 				void setOutput(Huffman::JPEGCollecter* NewOutput) { Output = NewOutput; return; }
+				void setCapture(DU* pNewStore) { pStore = pNewStore; return; }
 
 				//  next
 				//
@@ -1958,10 +2959,19 @@ namespace xymorg {
 				//
 				//  NOTES
 				//
+				//  When capturing the DU is stored (as is) in the capture buffer instead of being encoded.
+				//
 
 				void		next(DU& StuffedDU, int Channel) {
 					int16_t		DeltaDC = 0;														//  Delta from the previous DC value
 
+					//  Capture the DU for a later pass
+					if (pStore != nullptr) {
+						*pStore++ = StuffedDU;
+						COEmitted += 64;
+						return;
+					}
+
 					DeltaDC = StuffedDU.DC - PreviousDC[Channel];									//  Compute the delta
 					PreviousDC[Channel] = StuffedDU.DC;
 
@@ -1997,8 +3007,8 @@ namespace xymorg {
 
 				void	signalEndOfStream() {
 
-					//  Pass the signal up the pipeline
-					Output->signalEndOfStream();
+					//  Pass the signal up the pipeline (there is no output when capturing)
+					if (pStore == nullptr) Output->signalEndOfStream();
 
 					//  Return to caller
 					return;
@@ -2013,6 +3023,7 @@ namespace xymorg {
 
 				//  Output Object
 				Huffman::JPEGCollecter*			Output;
+				DU*								pStore;												//  Capture buffer (next DU)
 
 				//  DC & AC HuffmanTree & JPEGQuantizer objects
 				Huffman::HuffmanTree*			DCTree;												//  DC Huffman Tree
@@ -2050,6 +3061,9 @@ namespace xymorg {
 					ACTree = nullptr;
 					Q = nullptr;
 
+					//  Quantize by default
+					Prequantized = false;
+
 					//  Clear the counters
 					DUStuffed = 0;
 
@@ -2072,6 +3086,7 @@ namespace xymorg {
 				void setACHuffmanTree(Huffman::HuffmanTree* NewACTree) { ACTree = NewACTree; return; }
 				void setQuantizer(JPEGQuantizer* NewQ) { Q = NewQ; return; }
 				void setOutput(DUSplitter* NewOutput) { Output = NewOutput; return; }
+				void setPrequantized(bool NewPQ) { Prequantized = NewPQ; return; }
 
 				//  next
 				//
@@ -2090,8 +3105,8 @@ namespace xymorg {
 
 				void		next(DU& StuffedDU, int Channel) {
 
-					//  Dequantize the passed DU
-					Q->quantize(StuffedDU);
+					//  Quantize the passed DU (unless the DCT engine has already done so)
+					if (!Prequantized) Q->quantize(StuffedDU);
 
 					//  Set the selected huffman trees and quantizer in the next component
 					Output->setDCHuffmanTree(DCTree);
@@ -2140,6 +3155,7 @@ namespace xymorg {
 				Huffman::HuffmanTree*			DCTree;												//  DC Huffman Tree
 				Huffman::HuffmanTree*			ACTree;												//  AC Huffman Tree
 				JPEGQuantizer*					Q;													//  Quantizer
+				bool							Prequantized;										//  DUs arrive already quantized
 
 				//  Instrumentation
 				size_t							DUStuffed;
@@ -2310,6 +3326,9 @@ namespace xymorg {
 					//  Clear the output
 					Output = nullptr;
 
+					//  Default to the scaled-integer engine
+					Engine = FDCT_ENGINE_INTEGER;
+
 					//  Return to caller
 					return;
 				}
@@ -2326,6 +3345,7 @@ namespace xymorg {
 				void setACHuffmanTree(Huffman::HuffmanTree* NewACTree) { ACTree = NewACTree; return; }
 				void setQuantizer(JPEGQuantizer* NewQ) { Q = NewQ; return; }
 				void setOutput(ZigZagger* NewOutput) { Output = NewOutput; return; }
+				void setEngine(int NewEngine) { Engine = NewEngine; return; }
 
 				//  next
 				//
@@ -2341,40 +3361,26 @@ namespace xymorg {
 				//
 				//  NOTES
 				//
+				//  The fast engines fold quantization into the final scaling of the transform, the DU passed on is
+				//  already quantized and the downstream Quantizer is configured to pass it through unchanged.
+				//
 
 				void	next(DU& StuffedDU, int Channel) {
-					double					Element;																		//  Discrete element
-					double					Accumulator;																	//  Accumulator for element summing
 					DU						Out = {};																		//  Output DU
 
-					//  Convert each coefficient in the Data unit in turn
-					for (uint16_t vIndex = 0; vIndex < 8; vIndex++)
-					{
-						for (uint16_t uIndex = 0; uIndex < 8; uIndex++)
-						{
-							//  Perform the forward DCT transform
-							Accumulator = 0.0;
-
-							for (uint16_t xIndex = 0; xIndex < 8; xIndex++)
-							{
-								for (uint16_t yIndex = 0; yIndex < 8; yIndex++)
-								{
-									if (xIndex == 0 && yIndex == 0) Element = double(StuffedDU.DC);
-									else Element = double(StuffedDU.AC[((yIndex * 8) + xIndex) - 1]);
-									Element = Element * cos(((((2.0 * double(xIndex)) + 1.0) * double(uIndex)) * Pi) / 16.0);
-									Element = Element * cos(((((2.0 * double(yIndex)) + 1.0) * double(vIndex)) * Pi) / 16.0);
-									Accumulator += Element;
-								}
-							}
+					//  Apply the forward DCT using the selected engine
+					switch (Engine) {
+					case FDCT_ENGINE_FLOAT:
+						transformFloat(StuffedDU, Out);
+						break;
 
-							if (vIndex == 0) Accumulator = Accumulator * (1.0 / sqrt(2));
-							if (uIndex == 0) Accumulator = Accumulator * (1.0 / sqrt(2));
-							Accumulator = Accumulator / 4.0;
+					case FDCT_ENGINE_REFERENCE:
+						transformReference(StuffedDU, Out);
+						break;
 
-							//  Assign the sample to the Data Unit
-							if (vIndex == 0 && uIndex == 0) Out.DC = short(floor(Accumulator + 0.5));
-							else Out.AC[((vIndex * 8) + uIndex) - 1] = short(floor(Accumulator + 0.5));
-						}
+					default:
+						transformInteger(StuffedDU, Out);
+						break;
 					}
 
 					//  Set the selected huffman trees and quantizer in the next component
@@ -2413,20 +3419,297 @@ namespace xymorg {
 			private:
 				//*******************************************************************************************************************
 				//*																													*
-				//*  Private Members																								*
+				//*  Private Constants																								*
 				//*																													*
 				//*******************************************************************************************************************
 
-				//  Output Object
-				ZigZagger*						Output;
+				//  Fixed-point (13 bit fraction) rotation constants for the scaled-integer engine
+				static const int	IFIX_0_382683433 = 3135;
+				static const int	IFIX_0_541196100 = 4433;
+				static const int	IFIX_0_707106781 = 5793;
+				static const int	IFIX_1_306562965 = 10703;
 
-				//  DC & AC HuffmanTree & JPEGQuantizer objects
-				Huffman::HuffmanTree*			DCTree;												//  DC Huffman Tree
-				Huffman::HuffmanTree*			ACTree;												//  AC Huffman Tree
+				static const int	CONST_BITS = 13;												//  Fraction bits in the constants
+
+				//*******************************************************************************************************************
+				//*																													*
+				//*  Private Members																								*
+				//*																													*
+				//*******************************************************************************************************************
+
+				//  Output Object
+				ZigZagger*						Output;
+
+				//  DC & AC HuffmanTree & JPEGQuantizer objects
+				Huffman::HuffmanTree*			DCTree;												//  DC Huffman Tree
+				Huffman::HuffmanTree*			ACTree;												//  AC Huffman Tree
 				JPEGQuantizer*					Q;													//  Quantizer
 
+				//  Transform engine
+				int								Engine;												//  Selected FDCT engine
+
 				//  Instrumentation
 				size_t							DUStuffed;
+
+				//*******************************************************************************************************************
+				//*																													*
+				//*  Private Functions																								*
+				//*																													*
+				//*******************************************************************************************************************
+
+				//  multiply
+				//
+				//  Multiplies the passed value by a 13 bit fixed-point constant, with rounding
+				//
+				//  PARAMETERS
+				//
+				//		int				-		Value
+				//		int				-		Fixed-point constant
+				//
+				//  RETURNS
+				//
+				//		int				-		Product
+				//
+				//  NOTES
+				//
+
+				static int multiply(int Value, int Constant) {
+					return ((Value * Constant) + (1 << (CONST_BITS - 1))) >> CONST_BITS;
+				}
+
+				//  transformInteger
+				//
+				//  Applies the forward DCT and quantization using the scaled-integer engine
+				//
+				//  PARAMETERS
+				//
+				//		DU&				-		Reference to the input (level shifted) DU
+				//		DU&				-		Reference to the output DU
+				//
+				//  RETURNS
+				//
+				//  NOTES
+				//
+				//  The transform is the Arai, Agui & Nakajima 1-D FDCT (5 multiplies) applied first to the rows and then to
+				//  the columns. The outputs are left scaled by the AAN factors, which are removed by the quantizer.
+				//
+
+				void transformInteger(DU& InDU, DU& OutDU) {
+					int			WS[64];																				//  Workspace
+					int			tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;										//  Butterfly values
+					int			tmp10, tmp11, tmp12, tmp13;															//  Even part working
+					int			z1, z2, z3, z4, z5, z11, z13;														//  Working values
+					int*		pWS = nullptr;																		//  Current row/column
+					int			Step = 1;																			//  Element step
+
+					//  Unpack the samples into natural order
+					WS[0] = InDU.DC;
+					for (int acIndex = 0; acIndex < 63; acIndex++) WS[acIndex + 1] = InDU.AC[acIndex];
+
+					//  Pass 1 processes the rows, pass 2 the columns
+					for (int Pass = 0; Pass < 2; Pass++) {
+						for (int lIndex = 0; lIndex < 8; lIndex++) {
+							if (Pass == 0) {
+								pWS = WS + (lIndex * 8);
+								Step = 1;
+							}
+							else {
+								pWS = WS + lIndex;
+								Step = 8;
+							}
+
+							tmp0 = pWS[0] + pWS[7 * Step];
+							tmp7 = pWS[0] - pWS[7 * Step];
+							tmp1 = pWS[1 * Step] + pWS[6 * Step];
+							tmp6 = pWS[1 * Step] - pWS[6 * Step];
+							tmp2 = pWS[2 * Step] + pWS[5 * Step];
+							tmp5 = pWS[2 * Step] - pWS[5 * Step];
+							tmp3 = pWS[3 * Step] + pWS[4 * Step];
+							tmp4 = pWS[3 * Step] - pWS[4 * Step];
+
+							//  Even part
+							tmp10 = tmp0 + tmp3;
+							tmp13 = tmp0 - tmp3;
+							tmp11 = tmp1 + tmp2;
+							tmp12 = tmp1 - tmp2;
+
+							pWS[0] = tmp10 + tmp11;
+							pWS[4 * Step] = tmp10 - tmp11;
+
+							z1 = multiply(tmp12 + tmp13, IFIX_0_707106781);
+							pWS[2 * Step] = tmp13 + z1;
+							pWS[6 * Step] = tmp13 - z1;
+
+							//  Odd part
+							tmp10 = tmp4 + tmp5;
+							tmp11 = tmp5 + tmp6;
+							tmp12 = tmp6 + tmp7;
+
+							z5 = multiply(tmp10 - tmp12, IFIX_0_382683433);
+							z2 = multiply(tmp10, IFIX_0_541196100) + z5;
+							z4 = multiply(tmp12, IFIX_1_306562965) + z5;
+							z3 = multiply(tmp11, IFIX_0_707106781);
+
+							z11 = tmp7 + z3;
+							z13 = tmp7 - z3;
+
+							pWS[5 * Step] = z13 + z2;
+							pWS[3 * Step] = z13 - z2;
+							pWS[1 * Step] = z11 + z4;
+							pWS[7 * Step] = z11 - z4;
+						}
+					}
+
+					//  Descale and quantize
+					Q->quantizeAAN(WS, OutDU);
+
+					//  Return to caller
+					return;
+				}
+
+				//  transformFloat
+				//
+				//  Applies the forward DCT and quantization using the floating-point engine
+				//
+				//  PARAMETERS
+				//
+				//		DU&				-		Reference to the input (level shifted) DU
+				//		DU&				-		Reference to the output DU
+				//
+				//  RETURNS
+				//
+				//  NOTES
+				//
+				//  The same AAN flow graph as the scaled-integer engine evaluated in single precision.
+				//
+
+				void transformFloat(DU& InDU, DU& OutDU) {
+					float		WS[64];																				//  Workspace
+					float		tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;										//  Butterfly values
+					float		tmp10, tmp11, tmp12, tmp13;															//  Even part working
+					float		z1, z2, z3, z4, z5, z11, z13;														//  Working values
+					float*		pWS = nullptr;																		//  Current row/column
+					int			Step = 1;																			//  Element step
+
+					//  Unpack the samples into natural order
+					WS[0] = float(InDU.DC);
+					for (int acIndex = 0; acIndex < 63; acIndex++) WS[acIndex + 1] = float(InDU.AC[acIndex]);
+
+					//  Pass 1 processes the rows, pass 2 the columns
+					for (int Pass = 0; Pass < 2; Pass++) {
+						for (int lIndex = 0; lIndex < 8; lIndex++) {
+							if (Pass == 0) {
+								pWS = WS + (lIndex * 8);
+								Step = 1;
+							}
+							else {
+								pWS = WS + lIndex;
+								Step = 8;
+							}
+
+							tmp0 = pWS[0] + pWS[7 * Step];
+							tmp7 = pWS[0] - pWS[7 * Step];
+							tmp1 = pWS[1 * Step] + pWS[6 * Step];
+							tmp6 = pWS[1 * Step] - pWS[6 * Step];
+							tmp2 = pWS[2 * Step] + pWS[5 * Step];
+							tmp5 = pWS[2 * Step] - pWS[5 * Step];
+							tmp3 = pWS[3 * Step] + pWS[4 * Step];
+							tmp4 = pWS[3 * Step] - pWS[4 * Step];
+
+							//  Even part
+							tmp10 = tmp0 + tmp3;
+							tmp13 = tmp0 - tmp3;
+							tmp11 = tmp1 + tmp2;
+							tmp12 = tmp1 - tmp2;
+
+							pWS[0] = tmp10 + tmp11;
+							pWS[4 * Step] = tmp10 - tmp11;
+
+							z1 = (tmp12 + tmp13) * 0.707106781f;
+							pWS[2 * Step] = tmp13 + z1;
+							pWS[6 * Step] = tmp13 - z1;
+
+							//  Odd part
+							tmp10 = tmp4 + tmp5;
+							tmp11 = tmp5 + tmp6;
+							tmp12 = tmp6 + tmp7;
+
+							z5 = (tmp10 - tmp12) * 0.382683433f;
+							z2 = (tmp10 * 0.541196100f) + z5;
+							z4 = (tmp12 * 1.306562965f) + z5;
+							z3 = tmp11 * 0.707106781f;
+
+							z11 = tmp7 + z3;
+							z13 = tmp7 - z3;
+
+							pWS[5 * Step] = z13 + z2;
+							pWS[3 * Step] = z13 - z2;
+							pWS[1 * Step] = z11 + z4;
+							pWS[7 * Step] = z11 - z4;
+						}
+					}
+
+					//  Descale and quantize
+					Q->quantizeAAN(WS, OutDU);
+
+					//  Return to caller
+					return;
+				}
+
+				//  transformReference
+				//
+				//  Applies the forward DCT by direct evaluation of the 2-D transform
+				//
+				//  PARAMETERS
+				//
+				//		DU&				-		Reference to the input (level shifted) DU
+				//		DU&				-		Reference to the output DU
+				//
+				//  RETURNS
+				//
+				//  NOTES
+				//
+				//  This is the original O(n^4) implementation, it is retained as the accuracy reference for the fast engines.
+				//  The output is NOT quantized.
+				//
+
+				void transformReference(DU& StuffedDU, DU& Out) {
+					double					Element;																		//  Discrete element
+					double					Accumulator;																	//  Accumulator for element summing
+
+					//  Convert each coefficient in the Data unit in turn
+					for (uint16_t vIndex = 0; vIndex < 8; vIndex++)
+					{
+						for (uint16_t uIndex = 0; uIndex < 8; uIndex++)
+						{
+							//  Perform the forward DCT transform
+							Accumulator = 0.0;
+
+							for (uint16_t xIndex = 0; xIndex < 8; xIndex++)
+							{
+								for (uint16_t yIndex = 0; yIndex < 8; yIndex++)
+								{
+									if (xIndex == 0 && yIndex == 0) Element = double(StuffedDU.DC);
+									else Element = double(StuffedDU.AC[((yIndex * 8) + xIndex) - 1]);
+									Element = Element * cos(((((2.0 * double(xIndex)) + 1.0) * double(uIndex)) * Pi) / 16.0);
+									Element = Element * cos(((((2.0 * double(yIndex)) + 1.0) * double(vIndex)) * Pi) / 16.0);
+									Accumulator += Element;
+								}
+							}
+
+							if (vIndex == 0) Accumulator = Accumulator * (1.0 / sqrt(2));
+							if (uIndex == 0) Accumulator = Accumulator * (1.0 / sqrt(2));
+							Accumulator = Accumulator / 4.0;
+
+							//  Assign the sample to the Data Unit
+							if (vIndex == 0 && uIndex == 0) Out.DC = short(floor(Accumulator + 0.5));
+							else Out.AC[((vIndex * 8) + uIndex) - 1] = short(floor(Accumulator + 0.5));
+						}
+					}
+
+					//  Return to caller
+					return;
+				}
 			};
 
 			//*******************************************************************************************************************
@@ -2735,7 +4018,7 @@ namespace xymorg {
 					//  Clear the tables
 					DCTree[0] = nullptr;
 					DCTree[1] = nullptr;
-					DCTree[1] = nullptr;
+					DCTree[2] = nullptr;
 					ACTree[0] = nullptr;
 					ACTree[1] = nullptr;
 					ACTree[2] = nullptr;
@@ -3075,6 +4358,32 @@ namespace xymorg {
 					return;
 				}
 
+				//  nextMCU
+				//
+				//  Accepts a complete MCU (planar DUs) and pushes it into the pipeline.
+				//
+				//  PARAMETERS
+				//
+				//		MCU&				-		Reference to the MCU to be encoded
+				//
+				//  RETURNS
+				//
+				//  NOTES
+				//
+				//  The DU layout is the same as the one assembled by next(), which MUST NOT be used part way
+				//  through an MCU before calling this function.
+				//
+
+				void	nextMCU(MCU& Tile) {
+
+					//  Stuff the MCU into the pipeline
+					Output->next(Tile);
+					MCUStuffed++;
+
+					//  Return to caller
+					return;
+				}
+
 				//  signalEndOfStream
 				//
 				//  Signals that the end of the image data stream has been reached
@@ -3136,12 +4445,13 @@ namespace xymorg {
 
 			//  Configuration Functions
 			void		setQuantizer(int Channel, JPEGQuantizer* pNewDQ) { MCUS.setQuantizer(pNewDQ, Channel); return; }
-			void		setDCEncoder(int Channel, Huffman::HuffmanTree* pNewDec) { MCUS.setDCHuffmanTree(pNewDec, Channel); return; }
-			void		setACEncoder(int Channel, Huffman::HuffmanTree* pNewDec) { MCUS.setACHuffmanTree(pNewDec, Channel); return; }
-			void		setHSPM(int Channel, int Samples) { MCUS.setHSF(Samples, Channel); return; }
-			void		setVSPM(int Channel, int Samples) { MCUS.setVSF(Samples, Channel); return; }
+			void		setDCEncoder(int Channel, Huffman::HuffmanTree* pNewDec) { DCTree[Channel] = pNewDec; MCUS.setDCHuffmanTree(pNewDec, Channel); return; }
+			void		setACEncoder(int Channel, Huffman::HuffmanTree* pNewDec) { ACTree[Channel] = pNewDec; MCUS.setACHuffmanTree(pNewDec, Channel); return; }
+			void		setHSPM(int Channel, int Samples) { HSF[Channel] = Samples; MCUS.setHSF(Samples, Channel); return; }
+			void		setVSPM(int Channel, int Samples) { VSF[Channel] = Samples; MCUS.setVSF(Samples, Channel); return; }
 			void		setPrecision(int Precision) { DSDU.setPrecision(Precision); return; }
 			void		setMCUFF(BYTE NewFormFactor) { MCUFF = NewFormFactor; MCUS.setMCUFF(NewFormFactor); return; }
+			void		setFDCTEngine(int NewEngine) { DCTDU.setEngine(NewEngine); QDU.setPrequantized(NewEngine != FDCT_ENGINE_REFERENCE); return; }
 
 			//  encode
 			//
@@ -3173,11 +4483,84 @@ namespace xymorg {
 
 				//  Connect the end of the pipline to the Huffman CODEC collecter
 				SDU.setOutput(HCCollector);
+				SDU.setCapture(nullptr);
+
+				//  Return the collecter 
+				return Collecter(&MCUS, FF);
+			}
+
+			//  capture
+			//
+			//  Connects the input end of the encoding pipeline to a capture buffer
+			//
+			//  PARAMETERS
+			//
+			//		DU*								-			Pointer to the buffer that receives the quantized DUs
+			//		BYTE							-			The MCU Form Factor
+			//
+			//  RETURNS
+			//
+			//		Collector						-			The Collector that accepts the pixel stream of the unencoded image
+			//
+			//  NOTES
+			//
+			//	The pipeline is configured as for encode(). The DUs are stored in zig-zag order, in the sequence that they
+			//  would have been encoded, the buffer must hold every DU of the MCUs that will be collected.
+			//
+
+			Collecter		capture(DU* pStore, BYTE FF) {
+
+				//  Connect the end of the pipeline to the capture buffer
+				SDU.setOutput(nullptr);
+				SDU.setCapture(pStore);
 
 				//  Return the collecter 
 				return Collecter(&MCUS, FF);
 			}
 
+			//  replay
+			//
+			//  Entropy encodes a sequence of MCUs from a capture buffer
+			//
+			//  PARAMETERS
+			//
+			//		HuffmanCODEC::Collector*		-			Pointer to the Huffman CODEC Collector that provides the sink for the encoded image
+			//		DU*								-			Const pointer to the first captured DU
+			//		size_t							-			Number of MCUs to encode
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//	The Huffman trees and the sampling factors are those set for encode(), the DC predictors continue from any
+			//  previous use of the pipeline. The end of the stream is signalled once the MCUs have been encoded.
+			//
+
+			void			replay(Huffman::JPEGCollecter* HCCollector, const DU* pDUs, size_t MCUs) {
+				DU				StuffedDU = {};															//  DU being encoded
+
+				//  Connect the end of the pipline to the Huffman CODEC collecter
+				SDU.setOutput(HCCollector);
+				SDU.setCapture(nullptr);
+
+				for (size_t MX = 0; MX < MCUs; MX++) {
+					for (int CX = 0; CX < 3; CX++) {
+						SDU.setDCHuffmanTree(DCTree[CX]);
+						SDU.setACHuffmanTree(ACTree[CX]);
+						for (int DUX = 0; DUX < (HSF[CX] * VSF[CX]); DUX++) {
+							StuffedDU = *pDUs++;
+							SDU.next(StuffedDU, CX);
+						}
+					}
+				}
+
+				//  Signal the end of the stream
+				SDU.signalEndOfStream();
+
+				//  Return to caller
+				return;
+			}
+
 		private:
 
 			//*******************************************************************************************************************
@@ -3197,6 +4580,12 @@ namespace xymorg {
 
 			//  MCU Form Factor
 			BYTE				MCUFF;		
+
+			//  Channel resources (for replay)
+			Huffman::HuffmanTree*	DCTree[3];																//  DC Huffman Trees
+			Huffman::HuffmanTree*	ACTree[3];																//  AC Huffman Trees
+			int					HSF[3];																	//  Horizontal Sampling Factors
+			int					VSF[3];																	//  Vertical Sampling Factors
 		};
 
 		//*******************************************************************************************************************
@@ -3266,6 +4655,10 @@ namespace xymorg {
 					explodeNode(*Root, iIndex, &SymbolsThisLevel, &SymbolsAdded, HT, 0);
 				}
 
+				//  Build the table driven decoder and the flat encoder tables from the same definition
+				buildDLUT(HT.HTL, HT.HTEntry);
+				buildECT(HT.HTL, HT.HTEntry);
+
 				//  Return to caller
 				return;
 			}
@@ -3491,56 +4884,208 @@ namespace xymorg {
 
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
-		//*   Private Types		                                                                                            *
+		//*   SinkStream Class																								*
+		//*                                                                                                                 *
+		//*   Objects of this class are the (stuffed) output stream for the entropy encoder when an image is written to a	*
+		//*   ResourceSink. The encoded data is produced directly in space reserved from the sink, the space is committed	*
+		//*   and a fresh reservation made whenever it is close to full and when the stream is flushed.						*
 		//*                                                                                                                 *
 		//*******************************************************************************************************************
 
-		//  JPEG Resource Directory
-		typedef struct JRD {
-			BYTE					MCUFF;														//  MCU Form Factor
-			BYTE					QUse[3];													//  Quantisation Table Use (by channel)
-			JPEGQuantizer*			pQ[4];														//  (De)Quantizers
-			BYTE					DCUse[3];													//  DC Huffman Tree Use (by Channel)
-			JPEGHuffmanTree*		pHTDC[4];													//  DC Huffman Tree
-			BYTE					ACUse[3];													//  AC Huffman Tree Use (by Channel)
-			JPEGHuffmanTree*		pHTAC[4];													//  AC Huffman Tree
-			int						HSF[3];														//  Horizontal Sampling factor
-			int						VSF[3];														//  Vertical Sampling factor
-		} JRD;
+		class SinkStream : public StuffedStream {
+		public:
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Constructors                                                                                                  *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
 
-	public:
+			SinkStream(ResourceSink& Sink) : StuffedStream(), Out(Sink) {
+				acquire();
+				return;
+			}
 
-		//  Prevent Instantiation
-		JFIF() = delete;
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Public Functions                                                                                              *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
 
-		//*******************************************************************************************************************
-		//*                                                                                                                 *
-		//*   Public Functions                                                                                              *
-		//*                                                                                                                 *
-		//*******************************************************************************************************************
+			//  next
+			//
+			//  Writes the next byte to the reserved space, stuffing the output.
+			//
+			//  PARAMETERS
+			//
+			//		BYTE		-	The next byte to be written to the output
+			//
+			//	RETURNS
+			//
+			//	NOTES
+			//
 
-		//  loadImage
-		//
-		//  This static function will load the designated image into memory and return the content as an RGB train.
-		//
-		//  PARAMETERS
-		//
-		//		char*			-		Pointer to the name of the image to be loaded
-		//		VRMapper&		-		Reference to the resource mapper to use
-		//
-		//  RETURNS
-		//
-		//		Train*			-		Pointer to the image Train, NULL if it could not be loaded
-		//
-		//  NOTES
-		//
+			virtual void next(BYTE NextByte) {
+				if ((BytesWritten + SPILL_MARGIN) >= BufferSize) spill();
+				StuffedStream::next(NextByte);
+				return;
+			}
 
-		static Train<RGB>* loadImage(const char* ImgName, VRMapper& VRMap) {
+			//  drain
+			//
+			//  Writes all of the whole bytes held in an MSB aligned 64 bit reservoir to the reserved space, stuffing as needed.
+			//
+			//  PARAMETERS
+			//
+			//		uint64_t&		-		Reference to the bit reservoir (first bit to write is the MSB)
+			//		uint32_t&		-		Reference to the count of valid bits in the reservoir
+			//
+			//	RETURNS
+			//
+			//	NOTES
+			//
+			//		1.		A drain writes at most 16 (stuffed) bytes, the margin guarantees that the reservation never fills.
+			//
+
+			virtual void drain(uint64_t& Reservoir, uint32_t& Bits) {
+				if ((BytesWritten + SPILL_MARGIN) >= BufferSize) spill();
+				StuffedStream::drain(Reservoir, Bits);
+				return;
+			}
+
+			//  flush
+			//
+			//  Commits the content of the reserved space to the sink.
+			//
+			//  PARAMETERS
+			//
+			//	RETURNS
+			//
+			//	NOTES
+			//
+			//		1.		The stream holds no reservation after a flush, nothing further may be written to it.
+			//
+
+			virtual void flush() {
+				if (Buffer != nullptr) Out.commit(BytesWritten);
+				Buffer = nullptr;
+				BufferSize = 0;
+				BytesWritten = 0;
+				EndOfStream = true;
+				return;
+			}
+
+		private:
+
+			//*******************************************************************************************************************
+			//*																													*
+			//*  Private Members																								*
+			//*																													*
+			//*******************************************************************************************************************
+
+			static const size_t		MIN_RESERVE = 4096;											//  Minimum space reserved from the sink (bytes)
+			static const size_t		SPILL_MARGIN = 64;											//  Free space kept in the reservation (bytes)
+
+			ResourceSink&			Out;														//  Sink receiving the encoded data
+
+			//*******************************************************************************************************************
+			//*																													*
+			//*  Private Functions																								*
+			//*																													*
+			//*******************************************************************************************************************
+
+			//  acquire
+			//
+			//  Reserves the next block of space from the sink as the stream buffer.
+			//
+			//  PARAMETERS
+			//
+			//	RETURNS
+			//
+			//	NOTES
+			//
+			//		1.		If the sink has failed the stream is left at End-Of-Stream and further output is discarded.
+			//
+
+			void acquire() {
+				Buffer = Out.reserve(MIN_RESERVE, BufferSize);
+				BufferInc = 0;
+				BytesWritten = 0;
+				EndOfStream = (Buffer == nullptr);
+				return;
+			}
+
+			//  spill
+			//
+			//  Commits the content of the reserved space to the sink and reserves the next block.
+			//
+			//  PARAMETERS
+			//
+			//	RETURNS
+			//
+			//	NOTES
+			//
+
+			void spill() {
+				if (Buffer != nullptr) Out.commit(BytesWritten);
+				acquire();
+				return;
+			}
+		};
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Types		                                                                                            *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  JPEG Resource Directory
+		typedef struct JRD {
+			BYTE					MCUFF;														//  MCU Form Factor
+			BYTE					QUse[3];													//  Quantisation Table Use (by channel)
+			JPEGQuantizer*			pQ[4];														//  (De)Quantizers
+			BYTE					DCUse[3];													//  DC Huffman Tree Use (by Channel)
+			JPEGHuffmanTree*		pHTDC[4];													//  DC Huffman Tree
+			BYTE					ACUse[3];													//  AC Huffman Tree Use (by Channel)
+			JPEGHuffmanTree*		pHTAC[4];													//  AC Huffman Tree
+			int						HSF[3];														//  Horizontal Sampling factor
+			int						VSF[3];														//  Vertical Sampling factor
+			size_t					RestartInterval;											//  Restart Interval (MCUs, 0 - none)
+			bool					SharedQ;													//  Quantizers are shared (cached), not owned
+		} JRD;
+
+	public:
+
+		//  Prevent Instantiation
+		JFIF() = delete;
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Public Functions                                                                                              *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  loadImage
+		//
+		//  This static function will load the designated image into memory and return the content as an RGB train.
+		//
+		//  PARAMETERS
+		//
+		//		char*			-		Pointer to the name of the image to be loaded
+		//		VRMapper&		-		Reference to the resource mapper to use
+		//
+		//  RETURNS
+		//
+		//		Train*			-		Pointer to the image Train, NULL if it could not be loaded
+		//
+		//  NOTES
+		//
+
+		static Train<RGB>* loadImage(const char* ImgName, VRMapper& VRMap) {
 
-			return loadImageRGB(ImgName, VRMap);
+			return loadImageRGB(ImgName, VRMap, nullptr, 0);
 		}
 
-		//  loadImageRGB
+		//  loadImage
 		//
 		//  This static function will load the designated image into memory and return the content as an RGB train.
 		//
@@ -3548,6 +5093,7 @@ namespace xymorg {
 		//
 		//		char*			-		Pointer to the name of the image to be loaded
 		//		VRMapper&		-		Reference to the resource mapper to use
+		//		SWITCHES		-		Options to use for loading images
 		//
 		//  RETURNS
 		//
@@ -3556,29 +5102,145 @@ namespace xymorg {
 		//  NOTES
 		//
 
-		static Train<RGB>* loadImageRGB(const char* ImgName, VRMapper& VRMap) {
-			BYTE*			pImage = nullptr;													//  Pointer to the in-memory image
-			size_t			ImgSize = 0;														//  Image Size
+		static Train<RGB>* loadImage(const char* ImgName, VRMapper& VRMap, SWITCHES Opts) {
+
+			return loadImageRGB(ImgName, VRMap, nullptr, Opts);
+		}
+
+		//  loadImage
+		//
+		//  This static function will load a region of the designated image into memory and return the content as an RGB train.
+		//
+		//  PARAMETERS
+		//
+		//		char*			-		Pointer to the name of the image to be loaded
+		//		VRMapper&		-		Reference to the resource mapper to use
+		//		BoundingBox&	-		Const reference to the region of the image to be loaded
+		//		SWITCHES		-		Options to use for loading images
+		//
+		//  RETURNS
+		//
+		//		Train*			-		Pointer to the image Train, NULL if it could not be loaded
+		//
+		//  NOTES
+		//
+
+		static Train<RGB>* loadImage(const char* ImgName, VRMapper& VRMap, const BoundingBox& Region, SWITCHES Opts) {
+
+			return loadImageRGB(ImgName, VRMap, &Region, Opts);
+		}
+
+		//  loadImageRGB
+		//
+		//  This static function will load the designated image into memory and return the content as an RGB train.
+		//
+		//  PARAMETERS
+		//
+		//		char*			-		Pointer to the name of the image to be loaded
+		//		VRMapper&		-		Reference to the resource mapper to use
+		//		BoundingBox*	-		Const pointer to the region of the image to be loaded, NULL for the whole image
+		//		SWITCHES		-		Options to use for loading images
+		//
+		//  RETURNS
+		//
+		//		Train*			-		Pointer to the image Train, NULL if it could not be loaded
+		//
+		//  NOTES
+		//
+		//		1.		By default the image is decoded with the fixed-point IDCT engine, JFIF_LOAD_OPT_IDCT_FLOAT selects
+		//				the floating-point engine and JFIF_LOAD_OPT_IDCT_REFERENCE the (slow) direct transform.
+		//		2.		Subsampled chroma is replicated by default, JFIF_LOAD_OPT_FANCY_UPSAMPLING selects smooth
+		//				(triangular) interpolation.
+		//		3.		JFIF_LOAD_OPT_SCALE_1_2, _1_4 and _1_8 decode a reduced size image (rounded up), each DU is inverted
+		//				directly to 4x4, 2x2 or 1x1 samples so the full size image is never built. Chroma that is
+		//				subsampled in both directions is inverted to twice that size, keeping its resolution relative to
+		//				luma. The IDCT engine selection only applies to DUs that are inverted to the full 8x8.
+		//		4.		A region is given in image (unscaled) pixels and is clipped to each frame. Only the MCUs that
+		//				intersect the region are transformed and converted, entropy decoding stops after the last MCU row
+		//				of the region and restart intervals that lie outside it are not decoded at all.
+		//		5.		Progressive (SOF2) frames are supported, all of the scans are decoded before the single IDCT pass.
+		//				JFIF_LOAD_OPT_PROGRESSIVE_PREVIEW stops after the initial DC scan(s), giving a blocky full size
+		//				image for a fraction of the entropy decoding.
+		//
+
+		static Train<RGB>* loadImageRGB(const char* ImgName, VRMapper& VRMap, const BoundingBox* pRegion, SWITCHES Opts) {
+			ResourceView	Image;																//  View of the on-disk image
 			Train<RGB>*		pTrain = nullptr;													//  Constructed Train	
 
 			//  Safety
 			if (ImgName == nullptr) return nullptr;
 			if (ImgName[0] == '\0') return nullptr;
 
-			//  Load the on-disk image into memory
-			pImage = VRMap.loadResource(ImgName, ImgSize);
-			if (pImage == nullptr) return nullptr;
+			//  Map the on-disk image into memory
+			Image = VRMap.mapResource(ImgName);
+			if (!Image.isValid()) return nullptr;
 
 			//  Unbutton the image to a train
-			pTrain = unbuttonImage(pImage, ImgSize);
+			pTrain = unbuttonImage(Image, pRegion, Opts);
 
-			//  Free the image
-			free(pImage);
+			//  Release the image view
+			VRMap.unmapResource(Image);
 
 			//  Return the train
 			return pTrain;
 		}
 
+		//  loadImage
+		//
+		//  This static function will decode the passed in-memory JFIF (JPEG) image and return the content as an RGB train.
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Const pointer to the in-memory image
+		//		size_t			-		Size of the in-memory image (bytes)
+		//		SWITCHES		-		Options to use for loading images
+		//
+		//  RETURNS
+		//
+		//		Train*			-		Pointer to the image Train, NULL if it could not be decoded
+		//
+		//  NOTES
+		//
+		//		1.		The in-memory image is only read, it remains owned by the caller.
+		//
+
+		static Train<RGB>* loadImage(const BYTE* pImage, size_t Size, SWITCHES Opts) {
+
+			//  Safety
+			if (pImage == nullptr || Size == 0) return nullptr;
+
+			return unbuttonImage(const_cast<BYTE*>(pImage), Size, nullptr, Opts);
+		}
+
+		//  loadImage
+		//
+		//  This static function will decode a region of the passed in-memory JFIF (JPEG) image and return the content
+		//  as an RGB train.
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Const pointer to the in-memory image
+		//		size_t			-		Size of the in-memory image (bytes)
+		//		BoundingBox&	-		Const reference to the region of the image to be decoded
+		//		SWITCHES		-		Options to use for loading images
+		//
+		//  RETURNS
+		//
+		//		Train*			-		Pointer to the image Train, NULL if it could not be decoded
+		//
+		//  NOTES
+		//
+		//		1.		The in-memory image is only read, it remains owned by the caller.
+		//
+
+		static Train<RGB>* loadImage(const BYTE* pImage, size_t Size, const BoundingBox& Region, SWITCHES Opts) {
+
+			//  Safety
+			if (pImage == nullptr || Size == 0) return nullptr;
+
+			return unbuttonImage(const_cast<BYTE*>(pImage), Size, &Region, Opts);
+		}
+
 		//  storeImage
 		//
 		//  This static function will store the passed RGB Train into the designated JFIF (JPEG) Image file
@@ -3618,6 +5280,12 @@ namespace xymorg {
 		//
 		//  NOTES
 		//
+		//		1.		JFIF_STORE_OPT_OPTIMISE replaces the default (Annex K) Huffman tables with tables built from the
+		//				symbol statistics of the image. The quantized DUs of the first pass are held in memory (six
+		//				bytes per pixel with HIFI, three otherwise) and entropy encoded in the second pass.
+		//		2.		A quality (1 - 100) in options bits 16 - 23 scales the Annex K quantization tables (50 uses the
+		//				tables as is), without a quality the default tables are used.
+		//
 
 		static bool		storeImage(const char* ImgName, VRMapper& VRMap, Train<RGB>* pTrain, SWITCHES Opts) {
 
@@ -3643,8 +5311,7 @@ namespace xymorg {
 		//
 
 		static bool		storeRGBImage(const char* ImgName, VRMapper& VRMap, Train<RGB>* pTrain, SWITCHES Opts) {
-			BYTE*		pImage = nullptr;												//  Pointer to the in-memory image
-			size_t		ImgSize = 0;													//  Size of the in-memory image
+			ResourceWriter	Image;														//  Writer for the on-disk image
 
 			//  Safety
 			if (ImgName == nullptr) return false;
@@ -3654,17 +5321,18 @@ namespace xymorg {
 
 			//  Set the default options when needed
 
-			//  Build the in-memory image of the DIB On-Disk image
-			pImage = buttonImage(ImgSize, pTrain, Opts);
-			if (pImage == nullptr || ImgSize == 0) {
-				std::cerr << "ERROR: Unable to build an JFIF/JPEG on-disk image for: " << ImgName << "." << std::endl;
-				if (pImage != nullptr) free(pImage);
+			//  Open the on-disk image for streamed output
+			Image = VRMap.openResourceWriter(ImgName);
+			if (!Image.isOpen()) {
+				std::cerr << "ERROR: Failed to open JFIF/JPEG image: '" << ImgName << "' for output." << std::endl;
 				return false;
 			}
 
-			//  Store the in-memory image  (consumes the image memory allocation)
-			if (!VRMap.storeResource(ImgName, pImage, ImgSize)) {
-				std::cerr << "ERROR: Failed to store JFIF/JPEG image: '" << ImgName << "', (" << ImgSize << " bytes)." << std::endl;
+			//  Button the image straight into the on-disk image
+			if (!buttonImage(Image, pTrain, Opts) || !Image.close()) {
+				std::cerr << "ERROR: Failed to store JFIF/JPEG image: '" << ImgName << "', (" << Image.getBytesWritten() << " bytes written)." << std::endl;
+				Image.close();
+				VRMap.deleteResource(ImgName);
 				return false;
 			}
 
@@ -3672,6 +5340,35 @@ namespace xymorg {
 			return true;
 		}
 
+		//  storeImage
+		//
+		//  This static function will encode the passed RGB Train as a JFIF (JPEG) image written to the passed sink
+		//
+		//  PARAMETERS
+		//
+		//		ResourceSink&	-		Reference to the sink that receives the image
+		//		Train*			-		Pointer to the Train to store
+		//		SWITCHES		-		Options to use for storing images
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the complete image was written to the sink, otherwise false
+		//
+		//  NOTES
+		//
+		//		1.		Encoding to a ResourceBuffer holds the image in memory, the buffer content can be decoded with
+		//				loadImage() without a round trip through the file system.
+		//
+
+		static bool		storeImage(ResourceSink& Image, Train<RGB>* pTrain, SWITCHES Opts) {
+
+			//  Safety
+			if (pTrain == nullptr) return false;
+			if (pTrain->getCanvasHeight() == 0 || pTrain->getCanvasWidth() == 0) return false;
+
+			return buttonImage(Image, pTrain, Opts);
+		}
+
 		//  analyseImage
 		//
 		//  This static function will load the designated image into memory and provide an annotated dump of the contents
@@ -3829,6 +5526,10 @@ namespace xymorg {
 					showRST(BlockNo, Offset, Map, OS);
 					break;
 
+				case JFIF_BLOCK_DRI:
+					showDRI(BlockNo, Offset, Map, OS);
+					break;
+
 				case JFIF_BLOCK_FT:
 					showFT(BlockNo, Offset, Map, OS);
 					break;
@@ -3882,7 +5583,7 @@ namespace xymorg {
 
 		//  buttonImage
 		//
-		//  This static function button up the passed train into an on-disk DIB image format
+		//  This static function button up the passed train into an in-memory JFIF/JPEG image
 		//
 		//  PARAMETERS
 		//
@@ -3896,32 +5597,97 @@ namespace xymorg {
 		//
 		//  NOTES
 		//
+		//		1.		The image buffer is sized up front from the canvas (half a byte per pixel plus the headers) so that
+		//				typical images are encoded in place without the buffer being extended.
+		//
 
 		static BYTE* buttonImage(size_t& ImgSize, Train<RGB>* pTrain, SWITCHES Opts) {
-			BYTE*			pImage = nullptr;											//  In-Memory image
-			size_t			NewImgSize = 0;												//  Size of the in-memory image
-			Train<YCbCr>*	pCTrain = nullptr;											//  Canonical Train (Writeable)
+			ResourceBuffer	Image(4096 + (pTrain->getCanvasHeight() * pTrain->getCanvasWidth()) / 2);		//  In-Memory image
+
+			ImgSize = 0;
+			if (!buttonImage(Image, pTrain, Opts)) return nullptr;
+			return Image.acquireBuffer(ImgSize);
+		}
+
+		//  buttonImage
+		//
+		//  This static function button up the passed train into a JFIF/JPEG image written to the passed sink
+		//
+		//  PARAMETERS
+		//
+		//		ResourceSink&	-		Reference to the sink that receives the image
+		//		Train*			-		Pointer to the image Train to be buttoned
+		//		SWIRCHES		-		Options for storing the image
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the complete image was written to the sink, otherwise false
+		//
+		//  NOTES
+		//
+
+		static bool buttonImage(ResourceSink& Image, Train<RGB>* pTrain, SWITCHES Opts) {
+			bool			Written = false;											//  Image written
+			Train<RGB>*		pITrain = nullptr;											//  Flattened copy of the train (if needed)
+			Frame<RGB>*		pFrame = nullptr;											//  First frame of the train
+			JSOURCE			Src = {};													//  Source image for encoding
 
 			//  Auto adjust the Train Canvas Size
 			pTrain->autocorrect();
 
-			//  Construct the Canonical Train from the input train. The Canonical Train is directly writeble as a JPEG image.
-			//  The Canonical train IS YCbCr colourspace encoded.
-			//  The train is a flttened (single frame) train;
-			//  The dimensions of the frame will be expanded to complete MCU boundaries, the original size is preseved in the Train
+			//  The encoder reads the flattened canvas image. A train that holds a single opaque frame covering the whole
+			//  canvas IS its flattened image and is read in place, otherwise a flattened copy of the train is made.
+			pFrame = pTrain->getFirstFrame();
+			if (pTrain->getNumFrames() == 1 && pFrame->getRRow() == 0 && pFrame->getRCol() == 0 && !pFrame->hasTransparent() &&
+				pFrame->getHeight() == pTrain->getCanvasHeight() && pFrame->getWidth() == pTrain->getCanvasWidth()) {
+				Src.pRB = &pFrame->buffer();
+			}
+			else {
+				pITrain = new Train<RGB>(*pTrain);
+				pITrain->flatten();
+				Src.pRB = &pITrain->getFirstFrame()->buffer();
+			}
+
+			//  The dimensions of the scan are expanded to complete MCU boundaries
+			if (Opts & JFIF_STORE_OPT_HIFI) Src.MCUFF = 0x11;
+			else Src.MCUFF = 0x22;
+			Src.Height = Src.pRB->getHeight();
+			Src.Width = Src.pRB->getWidth();
+			Src.ScanH = ((Src.Height + (size_t(Src.MCUFF & 0x0F) * 8) - 1) / (size_t(Src.MCUFF & 0x0F) * 8)) * (size_t(Src.MCUFF & 0x0F) * 8);
+			Src.ScanW = ((Src.Width + (size_t(Src.MCUFF >> 4) * 8) - 1) / (size_t(Src.MCUFF >> 4) * 8)) * (size_t(Src.MCUFF >> 4) * 8);
 
-			pCTrain = buildCanonicalTrain(pTrain, Opts);
-			if (pCTrain == nullptr) return nullptr;
+			//  Serialise the source image into the sink
+			Written = serialiseTrain(Src, Image, Opts);
 
-			//  Serialise the Canonical Train into a memory image
-			pImage = serialiseTrain(pCTrain, NewImgSize, Opts);
+			//  Delete the flattened copy
+			if (pITrain != nullptr) delete pITrain;
 
-			//  Delete the Canonical Train
-			delete pCTrain;
+			//  Return showing if the image was written
+			return Written;
+		}
+
+		//  unbuttonImage
+		//
+		//  This static function will unbutton the content of a read-only view of an image to an RGB train.
+		//
+		//  PARAMETERS
+		//
+		//		ResourceView&	-		Const reference to the view of the image to be unbuttoned to a Train
+		//		BoundingBox*	-		Const pointer to the region to be unbuttoned, NULL for the whole image
+		//		SWITCHES		-		Options for loading the image
+		//
+		//  RETURNS
+		//
+		//		Train*			-		Pointer to the image Train, NULL if it could not be unbuttoned
+		//
+		//  NOTES
+		//
+		//		1.		Unbuttoning never writes to the in-memory image, so the view may be a read-only mapping.
+		//
 
-			//  Return the constructed image
-			ImgSize = NewImgSize;
-			return pImage;
+		static Train<RGB>* unbuttonImage(const ResourceView& Image, const BoundingBox* pRegion, SWITCHES Opts) {
+			if (!Image.isValid()) return nullptr;
+			return unbuttonImage(const_cast<BYTE*>(Image.getData()), Image.getSize(), pRegion, Opts);
 		}
 
 		//  unbuttonImage
@@ -3932,6 +5698,8 @@ namespace xymorg {
 		//
 		//		BYTE*			-		Pointer to the in-memory image to be unbuttoned to a Train
 		//		size_t			-		Size of the in-memory image (bytes)
+		//		BoundingBox*	-		Const pointer to the region to be unbuttoned, NULL for the whole image
+		//		SWITCHES		-		Options for loading the image
 		//
 		//  RETURNS
 		//
@@ -3940,7 +5708,7 @@ namespace xymorg {
 		//  NOTES
 		//
 
-		static Train<RGB>* unbuttonImage(BYTE* pImage, size_t Size) {
+		static Train<RGB>* unbuttonImage(BYTE* pImage, size_t Size, const BoundingBox* pRegion, SWITCHES Opts) {
 			Train<RGB>*		pTrain = nullptr;													//  Constructed Train	
 			ODIMap			Map = {};															//  Map of the ODI image
 			JRD				ResDir = {};														//  Resource Directory
@@ -3979,14 +5747,23 @@ namespace xymorg {
 					BlockNo++;
 					break;
 
-				case JFIF_BLOCK_SOF0:
+				case JFIF_BLOCK_DRI:
+					//  Define the Restart Interval
+					addRestartInterval(Map, BlockNo, ResDir);
+
+					//  Move to the next block
+					BlockNo++;
+					break;
+
+				case JFIF_BLOCK_SOF0:
 					//  Start of Frame (baseline DCT)
-					BlockNo += addFrame(Map, BlockNo, ResDir, pTrain);
+					BlockNo += addFrame(Map, BlockNo, ResDir, pTrain, pRegion, Opts);
 					break;
 
 				case JFIF_BLOCK_SOFX:
-					//  Alternate Frame - skipped
-					BlockNo += skipFrame(Map, BlockNo);
+					//  Progressive frames are decoded, other alternate frames are skipped
+					if (((JFIF_FRAME_HEADER*) Map.Blocks[BlockNo].Block)->ID == JFIF_BLKID_SOF2) BlockNo += addFrame(Map, BlockNo, ResDir, pTrain, pRegion, Opts);
+					else BlockNo += skipFrame(Map, BlockNo);
 					break;
 
 				default:
@@ -4023,6 +5800,8 @@ namespace xymorg {
 		//		size_t					-		Block index of the first block of the frame
 		//		JRD&					-		Reference to the resource directory
 		//		pTrain*					-		Pointer to the train to be extended
+		//		BoundingBox*			-		Const pointer to the region to be decoded, NULL for the whole frame
+		//		SWITCHES				-		Options for loading the image
 		//
 		//  RETURNS
 		//
@@ -4030,26 +5809,36 @@ namespace xymorg {
 		//
 		//  NOTES
 		//
+		//  A progressive frame (SOF2) is decoded scan by scan into a buffer of quantized coefficients that is then
+		//  passed through the decoder pipeline once all of the scans have been processed.
+		//
 
-		static size_t		addFrame(ODIMap& Map, size_t BlockNo, JRD& ResDir, Train<RGB>* pTrain) {
+		static size_t		addFrame(ODIMap& Map, size_t BlockNo, JRD& ResDir, Train<RGB>* pTrain, const BoundingBox* pRegion, SWITCHES Opts) {
 			size_t					BlocksConsumed = 0;												//  Number of blocks consumed by the frame
 			JFIF_FRAME_HEADER*		pSOF = (JFIF_FRAME_HEADER*) Map.Blocks[BlockNo].Block;			//  Start of Frame block
 			JFIF_SCAN_HEADER1*		pSH = nullptr;													//  Start of Scan block
-			JFIF_SCAN_HEADER2*		pSHX = nullptr;													//  Start of Scan Extension block
 			BYTE*					pBuffer = nullptr;												//  Address of the image buffer
 			size_t					BufferSize = 0;													//  Size of the image buffer
+			size_t					FirstEEB = 0;													//  Block index of the first EEB
+			size_t					Segments = 0;													//  Number of EEBs (restart intervals)
 			int						MaxHS = 0;														//  Max horizontal samples
 			int						MaxVS = 0;														//  Max vertical samples
 			size_t					FrameH = 0;														//  Frame Height
 			size_t					FrameW = 0;														//  Frame Width
 			size_t					ScanH = 0;														//  Scan Height
 			size_t					ScanW = 0;														//  Scan Width
+			size_t					Scale = loadScale(Opts);										//  Output scale divisor (1, 2, 4 or 8)
+			BoundingBox				Reg = {};														//  Region to be decoded (pixels)
+			BoundingBox				Out = {};														//  Region to be output (scaled pixels)
+			SizeVector				svCrop = {};													//  Crop from the planes to the output
+			CPLANES					Planes = {};													//  Decoded component planes
 			RasterBuffer<RGB>*		pRB = nullptr;													//  Pointer to the Raster Buffer
-			DecoderPipeline			Pipe;															//  Decoder Pipeline
-			Huffman					EDC;															//  Entropy Decoder
+			bool					Progressive = (pSOF->ID == JFIF_BLKID_SOF2);					//  Progressive (multi-scan) frame
+			COEFFS					Coeffs = {};													//  Coefficients of a progressive frame
+			bool					Skip = false;													//  Skip the scan (preview)
 
 			//  If the sampling precision is not 8 bits or the colour components is not 3 then skip this frame
-			if (pSOF->Precision != 8 || pSOF->Components != 3) {
+			if (Map.Blocks[BlockNo].BlockSize < (10 + (3 * sizeof(JFIF_FRAME_COMPONENT))) || pSOF->Precision != 8 || pSOF->Components != 3) {
 				std::cerr << "ERROR: Attempting to decode a JPEG frame that does NOT have a 3x8 colour scheme, skipping frame." << std::endl;
 				BlocksConsumed = 1;
 				while ((BlockNo + BlocksConsumed) < Map.NumBlocks) {
@@ -4059,21 +5848,21 @@ namespace xymorg {
 				return BlocksConsumed;
 			}
 
-			//  Prepare the pipeline for the frame
-			Pipe.setPrecision(pSOF->Precision);
-
-			//  Condition the pipe for each channel
+			//  Determine the max sampling across the channels, an MCU holds up to 2x2 DUs of each component
 			for (size_t CX = 0; CX < 3; CX++) {
-				//  Set the Horizontal and Vertical Sampling Factor
-				Pipe.setHSPM(int(CX), GetHSampfactor(pSOF->Comp[CX].HandV));
-				Pipe.setVSPM(int(CX), GetVSampFactor(pSOF->Comp[CX].HandV));
-
-				//  Determine the max sampling
+				if (GetHSampfactor(pSOF->Comp[CX].HandV) < 1 || GetHSampfactor(pSOF->Comp[CX].HandV) > 2 ||
+					GetVSampFactor(pSOF->Comp[CX].HandV) < 1 || GetVSampFactor(pSOF->Comp[CX].HandV) > 2) {
+					std::cerr << "ERROR: Attempting to decode a JPEG frame with unsupported sampling factors, skipping frame." << std::endl;
+					return skipFrame(Map, BlockNo);
+				}
 				if (GetHSampfactor(pSOF->Comp[CX].HandV) > MaxHS) MaxHS = GetHSampfactor(pSOF->Comp[CX].HandV);
 				if (GetVSampFactor(pSOF->Comp[CX].HandV) > MaxVS) MaxVS = GetVSampFactor(pSOF->Comp[CX].HandV);
+			}
 
-				//  Set the dequantizer to use
-				Pipe.setDequantizer(int(CX), ResDir.pQ[pSOF->Comp[CX].QTable]);
+			//  An empty frame has nothing to decode
+			if (GetSizeBE(pSOF->HLines) == 0 || GetSizeBE(pSOF->VLines) == 0) {
+				std::cerr << "ERROR: Attempting to decode a JPEG frame with no lines or columns, skipping frame." << std::endl;
+				return skipFrame(Map, BlockNo);
 			}
 
 			//  Determine the MCU Form Factor that will be used
@@ -4092,11 +5881,21 @@ namespace xymorg {
 			ScanW += (FrameW & ~(size_t(MaxHS) - size_t(1)));
 			BlocksConsumed++;
 
-			//  Set the MCU Form factor in the pipeline
-			Pipe.setMCUFF(ResDir.MCUFF);
+			//  A progressive frame accumulates the coefficients of every DU in the frame
+			if (Progressive) {
+				Coeffs.MCUCols = ScanW / size_t(MaxHS);
+				Coeffs.MCURows = ScanH / size_t(MaxVS);
+				for (size_t CX = 0; CX < 3; CX++) {
+					Coeffs.HSF[CX] = GetHSampfactor(pSOF->Comp[CX].HandV);
+					Coeffs.VSF[CX] = GetVSampFactor(pSOF->Comp[CX].HandV);
+					Coeffs.BW[CX] = ((((FrameW * size_t(Coeffs.HSF[CX]) * 8) + size_t(MaxHS) - 1) / size_t(MaxHS)) + 7) / 8;
+					Coeffs.BH[CX] = ((((FrameH * size_t(Coeffs.VSF[CX]) * 8) + size_t(MaxVS) - 1) / size_t(MaxVS)) + 7) / 8;
+					Coeffs.pDUs[CX] = (DU*) calloc(Coeffs.MCUCols * Coeffs.MCURows * size_t(Coeffs.HSF[CX] * Coeffs.VSF[CX]), sizeof(DU));
+				}
+			}
 
 			//
-			//  Cycle through the following blocks setting up the decode pipeline ready to decode 
+			//  Cycle through the following blocks collecting the resources and the entropy encoded data for the frame
 			//
 			while ((BlockNo + BlocksConsumed) < Map.NumBlocks) {
 				if (Map.Blocks[BlockNo + BlocksConsumed].BlockType == JFIF_BLOCK_SOF0 || Map.Blocks[BlockNo + BlocksConsumed].BlockType == JFIF_BLOCK_SOFX) break;
@@ -4116,80 +5915,964 @@ namespace xymorg {
 					BlocksConsumed++;
 					break;
 
+				case JFIF_BLOCK_DRI:
+					//  Define the Restart Interval
+					addRestartInterval(Map, BlockNo + BlocksConsumed, ResDir);
+					BlocksConsumed++;
+					break;
+
 				case JFIF_BLOCK_SOS:
-					//  Start of Scan - prepare for performing the image decoding
+					//  Start of Scan - capture the scan header for conditioning the decoder(s), a header that is too short
+					//  for its components is ignored
 					pSH = (JFIF_SCAN_HEADER1*) Map.Blocks[BlockNo + BlocksConsumed].Block;
-					pSHX = (JFIF_SCAN_HEADER2*) (&pSH->Comp[pSH->Components]);
+					if (Map.Blocks[BlockNo + BlocksConsumed].BlockSize < (5 + (size_t(pSH->Components) * sizeof(JFIF_SCAN_COMPONENT)) + sizeof(JFIF_SCAN_HEADER2))) {
+						pSH = nullptr;
+						BlocksConsumed++;
+						break;
+					}
 
-					for (size_t CX = 0; CX < 3; CX++) {
-						Pipe.setDCDecoder(int(CX), ResDir.pHTDC[GetDCSelector(pSH->Comp[CX].DCandAC)]);
-						Pipe.setACDecoder(int(CX), ResDir.pHTAC[GetACSelector(pSH->Comp[CX].DCandAC)]);
+					//  Each scan of a progressive frame is decoded into the coefficients as it is encountered,
+					//  a preview uses only the initial DC scan(s)
+					if (Progressive) {
+						if (Opts & JFIF_LOAD_OPT_PROGRESSIVE_PREVIEW) {
+							JFIF_SCAN_HEADER2*	pSH2 = (JFIF_SCAN_HEADER2*) &pSH->Comp[pSH->Components];
+							Skip = (pSH2->SSpecSel != 0 || GetABSelHi(pSH2->AHiandLo) != 0);
+						}
+						BlocksConsumed += decodeProgressiveScan(Map, BlockNo + BlocksConsumed, ResDir, pSOF, Coeffs, Skip);
 					}
-					BlocksConsumed++;
+					else BlocksConsumed++;
 					break;
 
 				case JFIF_BLOCK_EEB:
 					//  Accumulate the total size of the input buffer and capture the address of the first block
-					if (pBuffer == nullptr) pBuffer = Map.Blocks[BlockNo + BlocksConsumed].Block;
+					if (pBuffer == nullptr) {
+						pBuffer = Map.Blocks[BlockNo + BlocksConsumed].Block;
+						FirstEEB = BlockNo + BlocksConsumed;
+					}
 					BufferSize += Map.Blocks[BlockNo + BlocksConsumed].BlockSize;
+					Segments++;
 					BlocksConsumed++;
 					break;
 
 				case JFIF_BLOCK_RST:
-					//  Include the restart interval in the buffer length
+					//  Include the restart marker in the buffer length
 					BufferSize += Map.Blocks[BlockNo + BlocksConsumed].BlockSize;
 					BlocksConsumed++;
 					break;
+
+				default:
+					BlocksConsumed++;
+					break;
 				}
 			}
 
-			//  Setup a raster buffer to hold the decoded output.
-			//  NOTE: The ouput is rounded up (height and width) to accomodate complete MCUs
+			//  Make sure that there is a scan to decode
+			if (pSH == nullptr || (!Progressive && pBuffer == nullptr)) {
+				std::cerr << "ERROR: JPEG frame does not contain a scan, skipping frame." << std::endl;
+				if (Progressive) for (size_t CX = 0; CX < 3; CX++) free(Coeffs.pDUs[CX]);
+				return BlocksConsumed;
+			}
+
+			//  Make sure that the tables used by the frame (and a baseline scan) are defined
+			if (!checkResources(ResDir, pSOF, Progressive ? nullptr : pSH)) {
+				std::cerr << "ERROR: JPEG frame references undefined components or tables, skipping frame." << std::endl;
+				if (Progressive) for (size_t CX = 0; CX < 3; CX++) free(Coeffs.pDUs[CX]);
+				return BlocksConsumed;
+			}
+
+			//  Clip the region to the frame
+			Reg.Bottom = FrameH - 1;
+			Reg.Right = FrameW - 1;
+			if (pRegion != nullptr) {
+				if (pRegion->Top > Reg.Bottom || pRegion->Left > Reg.Right || pRegion->Bottom < pRegion->Top || pRegion->Right < pRegion->Left) {
+					std::cerr << "ERROR: The requested region is outside the JPEG frame, skipping frame." << std::endl;
+					if (Progressive) for (size_t CX = 0; CX < 3; CX++) free(Coeffs.pDUs[CX]);
+					return BlocksConsumed;
+				}
+				Reg.Top = pRegion->Top;
+				Reg.Left = pRegion->Left;
+				if (pRegion->Bottom < Reg.Bottom) Reg.Bottom = pRegion->Bottom;
+				if (pRegion->Right < Reg.Right) Reg.Right = pRegion->Right;
+			}
+
+			//  Determine the MCUs that cover the region, smooth upsampling needs the neighbouring MCUs as well
+			Planes.MCUCols = ScanW / size_t(MaxHS);
+			Planes.MCUReg.Top = Reg.Top / size_t(MaxVS);
+			Planes.MCUReg.Left = Reg.Left / size_t(MaxHS);
+			Planes.MCUReg.Bottom = Reg.Bottom / size_t(MaxVS);
+			Planes.MCUReg.Right = Reg.Right / size_t(MaxHS);
+			if (Opts & JFIF_LOAD_OPT_FANCY_UPSAMPLING) {
+				if (Planes.MCUReg.Top > 0) Planes.MCUReg.Top--;
+				if (Planes.MCUReg.Left > 0) Planes.MCUReg.Left--;
+				if ((Planes.MCUReg.Bottom + 1) * size_t(MaxVS) < ScanH) Planes.MCUReg.Bottom++;
+				if (Planes.MCUReg.Right + 1 < Planes.MCUCols) Planes.MCUReg.Right++;
+			}
+
+			//  Setup the component planes to hold the decoded samples and a raster buffer to hold the decoded output.
+			//  NOTE: Both cover complete MCUs, a scaled decode reduces each DU to DUSize x DUSize samples (CDUSize for
+			//  a subsampled component)
+
+			Planes.Height = (((Planes.MCUReg.Bottom - Planes.MCUReg.Top) + 1) * size_t(MaxVS)) / Scale;
+			Planes.Width = (((Planes.MCUReg.Right - Planes.MCUReg.Left) + 1) * size_t(MaxHS)) / Scale;
+			Planes.MCUFF = ResDir.MCUFF;
+			Planes.DUSize = 8 / Scale;
+			for (size_t CX = 0; CX < 3; CX++) {
+				Planes.HSF[CX] = GetHSampfactor(pSOF->Comp[CX].HandV);
+				Planes.VSF[CX] = GetVSampFactor(pSOF->Comp[CX].HandV);
+				Planes.CDUSize[CX] = componentDUSize(ResDir.MCUFF, Planes.HSF[CX], Planes.VSF[CX], Scale);
+				Planes.PH[CX] = ((Planes.Height / size_t(ResDir.MCUFF & 0x0F)) / Planes.DUSize) * size_t(Planes.VSF[CX]) * Planes.CDUSize[CX];
+				Planes.PW[CX] = ((Planes.Width / size_t(ResDir.MCUFF >> 4)) / Planes.DUSize) * size_t(Planes.HSF[CX]) * Planes.CDUSize[CX];
+				Planes.Plane[CX] = new BYTE[Planes.PH[CX] * Planes.PW[CX]];
+				memset(Planes.Plane[CX], 0, Planes.PH[CX] * Planes.PW[CX]);
+			}
+
+			pRB = new RasterBuffer<RGB>(Planes.Height, Planes.Width, nullptr);
+
+			//  Decode the image, independent restart intervals are decoded concurrently, the accumulated coefficients
+			//  of a progressive frame are decoded as a single pass
+			if (Progressive) {
+				replayCoefficients(Coeffs, ResDir, pSOF, Planes, Opts);
+				for (size_t CX = 0; CX < 3; CX++) free(Coeffs.pDUs[CX]);
+			}
+			else if (ResDir.RestartInterval > 0 && Segments > 1) decodeRestartIntervals(Map, FirstEEB, Segments, ResDir, pSOF, pSH, Planes, Opts);
+			else decodeScan(pBuffer, BufferSize, ResDir, pSOF, pSH, Planes, Opts);
+
+			//  Upsample and colour convert the planes into the raster buffer
+			emitRGB(Planes, pRB, (Opts & JFIF_LOAD_OPT_FANCY_UPSAMPLING) != 0);
+			for (size_t CX = 0; CX < 3; CX++) delete[] Planes.Plane[CX];
+
+			//  Crop the decoded MCUs to the (scaled) region, a partial pixel at the edge of a scaled image is retained
+			Out.Top = Reg.Top / Scale;
+			Out.Left = Reg.Left / Scale;
+			Out.Bottom = Reg.Bottom / Scale;
+			Out.Right = Reg.Right / Scale;
+			svCrop.Top = -int(Out.Top - ((Planes.MCUReg.Top * size_t(MaxVS)) / Scale));
+			svCrop.Left = -int(Out.Left - ((Planes.MCUReg.Left * size_t(MaxHS)) / Scale));
+			svCrop.Bottom = int(Out.Bottom + 1) - int((Planes.MCUReg.Top * size_t(MaxVS)) / Scale) - int(Planes.Height);
+			svCrop.Right = int(Out.Right + 1) - int((Planes.MCUReg.Left * size_t(MaxHS)) / Scale) - int(Planes.Width);
+			if (svCrop.Top != 0 || svCrop.Left != 0 || svCrop.Bottom != 0 || svCrop.Right != 0) pRB->resize(svCrop, nullptr);
+
+			//  Create a frame to carry the Raster Buffer and append it to the train
+			pTrain->append(new Frame<RGB>(pRB, 0, 0, nullptr));
+
+			//  Return the number of blocks consumed
+			return BlocksConsumed;
+		}
+
+		//  checkResources
+		//
+		//  This static function checks that the resources that will be used to decode a frame are defined
+		//
+		//  PARAMETERS
+		//
+		//		JRD&					-		Const reference to the resource directory
+		//		JFIF_FRAME_HEADER*		-		Pointer to the Start of Frame block
+		//		JFIF_SCAN_HEADER1*		-		Pointer to the (baseline) Start of Scan block, NULL if there is none
+		//
+		//  RETURNS
+		//
+		//		bool					-		true if the resources are defined, otherwise false
+		//
+		//  NOTES
+		//
+		//  The components of a baseline scan must be those of the frame in the same order.
+		//
+
+		static bool		checkResources(const JRD& ResDir, JFIF_FRAME_HEADER* pSOF, JFIF_SCAN_HEADER1* pSH) {
+
+			for (size_t CX = 0; CX < 3; CX++) {
+				if (pSOF->Comp[CX].QTable > 3 || ResDir.pQ[pSOF->Comp[CX].QTable] == nullptr) return false;
+			}
+
+			if (pSH == nullptr) return true;
+			if (pSH->Components != 3) return false;
+			for (size_t CX = 0; CX < 3; CX++) {
+				if (pSH->Comp[CX].ScanSelector != pSOF->Comp[CX].CompID) return false;
+				if (ResDir.pHTDC[GetDCSelector(pSH->Comp[CX].DCandAC)] == nullptr) return false;
+				if (ResDir.pHTAC[GetACSelector(pSH->Comp[CX].DCandAC)] == nullptr) return false;
+			}
+
+			//  All resources are present
+			return true;
+		}
+
+		//  loadScale
+		//
+		//  This static function returns the scale divisor selected by the load options
+		//
+		//  PARAMETERS
+		//
+		//		SWITCHES				-		Options for loading the image
+		//
+		//  RETURNS
+		//
+		//		size_t					-		Scale divisor (1, 2, 4 or 8)
+		//
+		//  NOTES
+		//
+
+		static size_t		loadScale(SWITCHES Opts) {
+			return size_t(1) << ((Opts & JFIF_LOAD_OPT_SCALE_MASK) >> 3);
+		}
+
+		//  componentDUSize
+		//
+		//  This static function returns the size of the decoded DUs of a component for a scaled decode
+		//
+		//  PARAMETERS
+		//
+		//		BYTE					-		MCU Form Factor (maximum sampling factors)
+		//		int						-		Horizontal sampling factor of the component
+		//		int						-		Vertical sampling factor of the component
+		//		size_t					-		Scale divisor (1, 2, 4 or 8)
+		//
+		//  RETURNS
+		//
+		//		size_t					-		Samples per side of a decoded DU (8, 4, 2 or 1)
+		//
+		//  NOTES
+		//
+		//  A subsampled component is inverted to a larger DU, up to the full 8x8, while it remains subsampled in both
+		//  directions. So 4:2:0 chroma keeps the luma resolution in a scaled image rather than being upsampled, any
+		//  remaining (single direction) subsampling is upsampled as usual.
+		//
+
+		static size_t		componentDUSize(BYTE MCUFF, int HSF, int VSF, size_t Scale) {
+			size_t			Base = 8 / Scale;														//  Luma (maximum sampling) DU size
+			size_t			Size = Base;															//  Component DU size
+
+			while (Size < 8 && (size_t(HSF) * Size * 2) <= (size_t(MCUFF >> 4) * Base) && (size_t(VSF) * Size * 2) <= (size_t(MCUFF & 0x0F) * Base)) Size *= 2;
+			return Size;
+		}
+
+		//  conditionDecoder
+		//
+		//  This static function will setup a decoder pipeline for the frame and scan
+		//
+		//  PARAMETERS
+		//
+		//		DecoderPipeline&		-		Reference to the pipeline to be conditioned
+		//		JRD&					-		Reference to the resource directory
+		//		JFIF_FRAME_HEADER*		-		Pointer to the Start of Frame block
+		//		JFIF_SCAN_HEADER1*		-		Pointer to the Start of Scan block, NULL when replaying coefficients
+		//		SWITCHES				-		Options for loading the image
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+
+		static void		conditionDecoder(DecoderPipeline& Pipe, JRD& ResDir, JFIF_FRAME_HEADER* pSOF, JFIF_SCAN_HEADER1* pSH, SWITCHES Opts) {
+
+			//  Prepare the pipeline for the frame
+			Pipe.setPrecision(pSOF->Precision);
+			if (Opts & JFIF_LOAD_OPT_IDCT_REFERENCE) Pipe.setIDCTEngine(DecoderPipeline::IDCT_ENGINE_REFERENCE);
+			else if (Opts & JFIF_LOAD_OPT_IDCT_FLOAT) Pipe.setIDCTEngine(DecoderPipeline::IDCT_ENGINE_FLOAT);
+			else Pipe.setIDCTEngine(DecoderPipeline::IDCT_ENGINE_INTEGER);
+
+			//  Condition the pipe for each channel
+			for (size_t CX = 0; CX < 3; CX++) {
+				//  Set the Horizontal and Vertical Sampling Factor and the size of the decoded DUs
+				Pipe.setHSPM(int(CX), GetHSampfactor(pSOF->Comp[CX].HandV));
+				Pipe.setVSPM(int(CX), GetVSampFactor(pSOF->Comp[CX].HandV));
+				Pipe.setIDCTOutputSize(int(CX), int(componentDUSize(ResDir.MCUFF, GetHSampfactor(pSOF->Comp[CX].HandV), GetVSampFactor(pSOF->Comp[CX].HandV), loadScale(Opts))));
+
+				//  Set the dequantizer and the entropy decoders to use
+				Pipe.setDequantizer(int(CX), ResDir.pQ[pSOF->Comp[CX].QTable]);
+				if (pSH != nullptr) {
+					Pipe.setDCDecoder(int(CX), ResDir.pHTDC[GetDCSelector(pSH->Comp[CX].DCandAC)]);
+					Pipe.setACDecoder(int(CX), ResDir.pHTAC[GetACSelector(pSH->Comp[CX].DCandAC)]);
+				}
+			}
+
+			//  Set the MCU Form factor in the pipeline, the DUs are delivered at their native sampling
+			Pipe.setMCUFF(ResDir.MCUFF);
+			Pipe.setUpsampling(false);
+
+			//  Return to caller
+			return;
+		}
+
+		//  decodeScan
+		//
+		//  This static function will decode a complete scan serially into the Raster Buffer
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*					-		Pointer to the entropy encoded data
+		//		size_t					-		Size of the entropy encoded data (including any restart markers)
+		//		JRD&					-		Reference to the resource directory
+		//		JFIF_FRAME_HEADER*		-		Pointer to the Start of Frame block
+		//		JFIF_SCAN_HEADER1*		-		Pointer to the Start of Scan block
+		//		CPLANES&				-		Reference to the component planes to be populated
+		//		SWITCHES				-		Options for loading the image
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+
+		static void		decodeScan(BYTE* pBuffer, size_t BufferSize, JRD& ResDir, JFIF_FRAME_HEADER* pSOF, JFIF_SCAN_HEADER1* pSH, CPLANES& Planes, SWITCHES Opts) {
+			DecoderPipeline			Pipe;															//  Decoder Pipeline
+			Huffman					EDC;															//  Entropy Decoder
+			size_t					MCUs = (Planes.MCUReg.Bottom + 1) * Planes.MCUCols;			//  MCUs to be decoded (up to the end of the region)
+
+			//  Prepare the pipeline
+			conditionDecoder(Pipe, ResDir, pSOF, pSH, Opts);
 
-			pRB = new RasterBuffer<RGB>(ScanH, ScanW, nullptr);
-			
 			//  Setup a stuffed byte stream to provide the input image
 			StuffedStream		bsIn(pBuffer, BufferSize);
 
 			//
 			//  Arrange the plumbing for the input and output:
 			//
-			//		StuffedStream ==> Huffman ==> Huffman::Emitter ==> Pipeline ==> Pipeline::Emitter ==> RasterBuffer
+			//		StuffedStream ==> Huffman ==> Huffman::Emitter ==> Pipeline ==> Pipeline::Emitter ==> Component Planes
 			//
 
 			Huffman::JPEGEmitter		Source = EDC.decodeJPEG(bsIn);
 			DecoderPipeline::Emitter	Sink = Pipe.decode(&Source);
 
-			//
-			//  Populate the Raster Buffer. Use an iterator that operates in sequential MCU order over the buffer (matching the decode sequence).
-			//  Pixels are returned one at a time in the YCbCr colour space so must be converted to RGB before adding to the Raster Buffer.
-			//
+			//  Populate the planes, one MCU at a time in sequential MCU order (matching the decode sequence)
+			if (!decodeMCUs(Pipe, Sink, Planes, 0, MCUs)) {
+				std::cerr << "ERROR: JPEG decoding stream has terminated before filling an image buffer." << std::endl;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  decodeMCUs
+		//
+		//  This static function will populate a range of MCUs in the component planes from a decoder pipeline
+		//
+		//  PARAMETERS
+		//
+		//		DecoderPipeline&		-		Reference to the decoder pipeline
+		//		Emitter&				-		Reference to the decoder pipeline emitter
+		//		CPLANES&				-		Reference to the component planes
+		//		size_t					-		Index of the first MCU to decode
+		//		size_t					-		Index of the MCU following the last one to decode
+		//
+		//  RETURNS
+		//
+		//		bool					-		true if all of the MCUs were decoded, false if the stream ran short
+		//
+		//  NOTES
+		//
+		//  MCUs are numbered left to right, top to bottom. The DUs of each MCU are stored at the native sampling of
+		//  their component, upsampling and colour conversion are left to emitRGB(). MCUs outside the region held in
+		//  the planes are entropy decoded (to keep the decoder in step) but not transformed or stored.
+		//
+
+		static bool		decodeMCUs(DecoderPipeline& Pipe, DecoderPipeline::Emitter& Sink, CPLANES& Planes, size_t FirstMCU, size_t LastMCU) {
+			MCU				Tile = {};																//  Planar MCU
+			bool			Wanted = false;															//  MCU is inside the region
+
+			for (size_t MX = FirstMCU; MX < LastMCU; MX++) {
+				Wanted = inRegion(Planes, MX);
+				Pipe.setDiscard(!Wanted);
+				if (!Sink.nextMCU(Tile)) return false;
+				if (Wanted) storeMCU(Tile, Planes, MX);
+			}
+
+			//  Return to caller
+			return true;
+		}
+
+		//  inRegion
+		//
+		//  This static function determines if an MCU is within the region held in the component planes
+		//
+		//  PARAMETERS
+		//
+		//		CPLANES&		-		Const reference to the component planes
+		//		size_t			-		Index of the MCU
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the MCU is within the region, otherwise false
+		//
+		//  NOTES
+		//
+
+		static bool		inRegion(const CPLANES& Planes, size_t MX) {
+			size_t			MR = MX / Planes.MCUCols;												//  MCU row
+			size_t			MC = MX % Planes.MCUCols;												//  MCU column
+
+			return MR >= Planes.MCUReg.Top && MR <= Planes.MCUReg.Bottom && MC >= Planes.MCUReg.Left && MC <= Planes.MCUReg.Right;
+		}
+
+		//  storeMCU
+		//
+		//  This static function will store the DUs of a decoded MCU into the component planes
+		//
+		//  PARAMETERS
+		//
+		//		MCU&			-		Const reference to the decoded MCU (not upsampled)
+		//		CPLANES&		-		Reference to the component planes
+		//		size_t			-		Index of the MCU
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+
+		static void		storeMCU(const MCU& Tile, CPLANES& Planes, size_t MX) {
+			size_t			DUS = 0;																//  Samples per side of a DU
+			size_t			MR = (MX / Planes.MCUCols) - Planes.MCUReg.Top;						//  MCU row in the planes
+			size_t			MC = (MX % Planes.MCUCols) - Planes.MCUReg.Left;						//  MCU column in the planes
+			int16_t			Samples[64] = {};														//  DU samples (row major)
+			const DU*		pDUs = nullptr;															//  DUs of the component
+			BYTE*			pOut = nullptr;															//  Output row
+
+			//  MCUs outside the region held in the planes are not stored
+			if (!inRegion(Planes, MX)) return;
+
+			for (size_t CX = 0; CX < 3; CX++) {
+				if (CX == 0) pDUs = Tile.DUY;
+				else if (CX == 1) pDUs = Tile.DUCb;
+				else pDUs = Tile.DUCr;
+				DUS = Planes.CDUSize[CX];
+
+				//  The DUs of the MCU must lie within the plane of the component
+				if (((MR + 1) * size_t(Planes.VSF[CX]) * DUS) > Planes.PH[CX] || ((MC + 1) * size_t(Planes.HSF[CX]) * DUS) > Planes.PW[CX]) continue;
+
+				for (size_t DUR = 0; DUR < size_t(Planes.VSF[CX]); DUR++) {
+					for (size_t DUC = 0; DUC < size_t(Planes.HSF[CX]); DUC++) {
+
+						//  A DU is the DC sample followed by the 63 AC samples, a scaled DU uses only the leading samples
+						memcpy(Samples, &pDUs[(DUR * 2) + DUC], sizeof(DU));
+
+						for (size_t RX = 0; RX < DUS; RX++) {
+							pOut = Planes.Plane[CX] + ((((MR * size_t(Planes.VSF[CX])) + DUR) * DUS) + RX) * Planes.PW[CX];
+							pOut += ((MC * size_t(Planes.HSF[CX])) + DUC) * DUS;
+							if (DUS == 8) {
+								for (size_t CoX = 0; CoX < 8; CoX++) pOut[CoX] = BYTE(Samples[(RX * 8) + CoX]);
+							}
+							else {
+								for (size_t CoX = 0; CoX < DUS; CoX++) pOut[CoX] = BYTE(Samples[(RX * DUS) + CoX]);
+							}
+						}
+					}
+				}
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  emitRGB
+		//
+		//  This static function is the output stage of the decoder, it upsamples the component planes and converts them
+		//  to RGB rows directly in the Raster Buffer
+		//
+		//  PARAMETERS
+		//
+		//		CPLANES&				-		Const reference to the decoded component planes
+		//		RasterBuffer<RGB>*		-		Pointer to the (MCU aligned) Raster Buffer to be populated
+		//		bool					-		true for triangular upsampling, false to replicate samples
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  Each MCU row is an independent task, the planes are complete so neighbouring samples are always available.
+		//
+
+		static void		emitRGB(const CPLANES& Planes, RasterBuffer<RGB>* pRB, bool Fancy) {
+			size_t			MCUH = size_t(Planes.MCUFF & 0x0F) * Planes.DUSize;					//  MCU Height (output rows)
+
+			WorkGang::run(Planes.Height / MCUH, [&](size_t MR) {
+				BYTE*			pWork = new BYTE[3 * Planes.Width];									//  Upsampled component rows
+				int*			pSums = new int[Planes.Width];										//  Vertical sums (triangular)
+				const BYTE*		pRow[3] = {};														//  Full resolution component rows
+
+				for (size_t RX = MR * MCUH; RX < (MR + 1) * MCUH; RX++) {
+					for (size_t CX = 0; CX < 3; CX++) pRow[CX] = upsampleRow(Planes, CX, RX, Fancy, pWork + (CX * Planes.Width), pSums);
+					ColourConverter::convertRowToRGB(pRow[0], pRow[1], pRow[2], pRB->getPixel(RX, 0), Planes.Width);
+				}
+
+				delete[] pWork;
+				delete[] pSums;
+			});
+
+			//  Return to caller
+			return;
+		}
+
+		//  upsampleRow
+		//
+		//  This static function will return a full resolution row of samples for a component
+		//
+		//  PARAMETERS
+		//
+		//		CPLANES&			-		Const reference to the decoded component planes
+		//		size_t				-		Component index
+		//		size_t				-		Output row number
+		//		bool				-		true for triangular upsampling, false to replicate samples
+		//		BYTE*				-		Pointer to a work row (scan width) that may receive the output
+		//		int*				-		Pointer to a work array (scan width) for vertical sums
+		//
+		//  RETURNS
+		//
+		//		BYTE*				-		Const pointer to the full resolution row
+		//
+		//  NOTES
+		//
+		//  A component that is not subsampled is returned in place. Triangular upsampling weights the nearest sample 3/4
+		//  and the next nearest 1/4 in each subsampled direction, edges repeat the outermost sample.
+		//
+
+		static const BYTE*	upsampleRow(const CPLANES& Planes, size_t CX, size_t Row, bool Fancy, BYTE* pOut, int* pSums) {
+			size_t			HR = (size_t(Planes.MCUFF >> 4) * Planes.DUSize) / (size_t(Planes.HSF[CX]) * Planes.CDUSize[CX]);		//  Horizontal ratio
+			size_t			VR = (size_t(Planes.MCUFF & 0x0F) * Planes.DUSize) / (size_t(Planes.VSF[CX]) * Planes.CDUSize[CX]);		//  Vertical ratio
+			size_t			PW = Planes.PW[CX];													//  Plane width
+			size_t			SRow = Row / VR;													//  Nearest sample row
+			size_t			ORow = SRow;														//  Next nearest sample row
+			const BYTE*		pNear = Planes.Plane[CX] + (SRow * PW);							//  Nearest samples
+			const BYTE*		pFar = nullptr;														//  Next nearest samples
+
+			//  Full resolution
+			if (HR == 1 && VR == 1) return pNear;
+
+			//  Replicate samples
+			if (!Fancy) {
+				if (HR == 1) return pNear;
+				for (size_t SX = 0; SX < PW; SX++) {
+					pOut[SX * 2] = pNear[SX];
+					pOut[(SX * 2) + 1] = pNear[SX];
+				}
+				return pOut;
+			}
+
+			//  Triangular, form the vertical sums (4x scale)
+			if (VR == 2) {
+				if (Row & 1) {
+					if (SRow + 1 < Planes.PH[CX]) ORow = SRow + 1;
+				}
+				else {
+					if (SRow > 0) ORow = SRow - 1;
+				}
+				pFar = Planes.Plane[CX] + (ORow * PW);
+				for (size_t SX = 0; SX < PW; SX++) pSums[SX] = (3 * int(pNear[SX])) + int(pFar[SX]);
+			}
+			else {
+				for (size_t SX = 0; SX < PW; SX++) pSums[SX] = 4 * int(pNear[SX]);
+			}
+
+			//  Horizontal interpolation and descaling
+			if (HR == 2) {
+				for (size_t SX = 0; SX < PW; SX++) {
+					int		Left = pSums[(SX > 0) ? SX - 1 : SX];
+					int		Right = pSums[(SX + 1 < PW) ? SX + 1 : SX];
+
+					pOut[SX * 2] = BYTE(((3 * pSums[SX]) + Left + 8) >> 4);
+					pOut[(SX * 2) + 1] = BYTE(((3 * pSums[SX]) + Right + 7) >> 4);
+				}
+			}
+			else {
+				for (size_t SX = 0; SX < PW; SX++) pOut[SX] = BYTE((pSums[SX] + 2) >> 2);
+			}
+
+			//  Return the upsampled row
+			return pOut;
+		}
+
+		//  decodeRestartIntervals
+		//
+		//  This static function will decode the restart intervals of a scan concurrently into the Raster Buffer
+		//
+		//  PARAMETERS
+		//
+		//		Map&					-		Reference to the map of the in-memory image
+		//		size_t					-		Block index of the first EEB of the scan
+		//		size_t					-		Number of EEBs (restart intervals) in the scan
+		//		JRD&					-		Reference to the resource directory
+		//		JFIF_FRAME_HEADER*		-		Pointer to the Start of Frame block
+		//		JFIF_SCAN_HEADER1*		-		Pointer to the Start of Scan block
+		//		CPLANES&				-		Reference to the component planes to be populated
+		//		SWITCHES				-		Options for loading the image
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  Each restart interval starts byte aligned with the DC predictors reset, so each one is decoded by its own
+		//  pipeline and written directly to the MCU positions that it covers. The decoders share the (read-only)
+		//  quantizers and Huffman trees in the resource directory.
+		//
+
+		static void		decodeRestartIntervals(ODIMap& Map, size_t FirstEEB, size_t Segments, JRD& ResDir, JFIF_FRAME_HEADER* pSOF, JFIF_SCAN_HEADER1* pSH, CPLANES& Planes, SWITCHES Opts) {
+			size_t					MCUs = (Planes.MCUReg.Bottom + 1) * Planes.MCUCols;			//  MCUs to be decoded (up to the end of the region)
+			size_t*					SegBlock = new size_t[Segments];								//  Block index of each EEB
+			size_t					SX = 0;															//  Segment index
+			std::atomic<bool>		Truncated(false);												//  A segment ran short
+
+			//  Locate the EEB for each restart interval
+			for (size_t BX = FirstEEB; BX < Map.NumBlocks && SX < Segments; BX++) {
+				if (Map.Blocks[BX].BlockType == JFIF_BLOCK_EEB) SegBlock[SX++] = BX;
+			}
+
+			//  Decode the intervals
+			WorkGang::run(Segments, [&](size_t SegNo) {
+				DecoderPipeline			Pipe;														//  Decoder Pipeline
+				Huffman					EDC;														//  Entropy Decoder
+				size_t					FirstMCU = SegNo * ResDir.RestartInterval;					//  First MCU in the interval
+				size_t					LastMCU = FirstMCU + ResDir.RestartInterval;				//  MCU following the interval
+
+				if (FirstMCU >= MCUs) return;
+				if (LastMCU > MCUs || SegNo == (Segments - 1)) LastMCU = MCUs;
+
+				//  Intervals that do not touch the region are not decoded, the last wanted MCU ends the interval
+				while (LastMCU > FirstMCU && !inRegion(Planes, LastMCU - 1)) LastMCU--;
+				if (LastMCU == FirstMCU) return;
+
+				conditionDecoder(Pipe, ResDir, pSOF, pSH, Opts);
+
+				StuffedStream				bsIn(Map.Blocks[SegBlock[SegNo]].Block, Map.Blocks[SegBlock[SegNo]].BlockSize);
+				Huffman::JPEGEmitter		Source = EDC.decodeJPEG(bsIn);
+				DecoderPipeline::Emitter	Sink = Pipe.decode(&Source);
+
+				if (!decodeMCUs(Pipe, Sink, Planes, FirstMCU, LastMCU)) Truncated = true;
+			});
+
+			if (Truncated) std::cerr << "ERROR: JPEG restart interval has terminated before filling its MCUs." << std::endl;
+
+			delete[] SegBlock;
+
+			//  Return to caller
+			return;
+		}
+
+		//  decodeProgressiveScan
+		//
+		//  This static function will decode a scan of a progressive frame into the coefficient buffers
+		//
+		//  PARAMETERS
+		//
+		//		Map&					-		Reference to the map of the in-memory image
+		//		size_t					-		Block index of the Start of Scan block
+		//		JRD&					-		Reference to the resource directory
+		//		JFIF_FRAME_HEADER*		-		Pointer to the Start of Frame block
+		//		COEFFS&					-		Reference to the coefficient buffers to be updated
+		//		bool					-		true if the scan is to be skipped
+		//
+		//  RETURNS
+		//
+		//		size_t					-		Number of blocks consumed by the scan
+		//
+		//  NOTES
+		//
+		//  The scan may be a first or refining pass over the DC coefficient (spectral selection 0) or over a band of
+		//  AC coefficients (a single component). Each restart interval starts byte aligned with the DC predictors and
+		//  the end-of-band run reset, so the intervals are decoded concurrently into the DUs that they cover.
+		//
+
+		static size_t		decodeProgressiveScan(ODIMap& Map, size_t BlockNo, JRD& ResDir, JFIF_FRAME_HEADER* pSOF, COEFFS& Coeffs, bool Skip) {
+			size_t					BlocksConsumed = 1;												//  Number of blocks consumed by the scan
+			JFIF_SCAN_HEADER1*		pSH = (JFIF_SCAN_HEADER1*) Map.Blocks[BlockNo].Block;			//  Start of Scan block
+			JFIF_SCAN_HEADER2*		pSH2 = (JFIF_SCAN_HEADER2*) &pSH->Comp[pSH->Components];		//  Spectral selection & approximation
+			size_t					Ns = pSH->Components;											//  Components in the scan
+			size_t					SC[3] = {};														//  Frame component index (by scan component)
+			int						Ss = pSH2->SSpecSel;											//  Start of spectral selection
+			int						Se = pSH2->ESpecSel;											//  End of spectral selection
+			int						Ah = GetABSelHi(pSH2->AHiandLo);								//  Previous approximation bit position
+			int						Al = GetABSelLo(pSH2->AHiandLo);								//  Approximation bit position
+			size_t					Units = 0;														//  Units (MCUs or DUs) in the scan
+			size_t					Segments = 0;													//  Number of EEBs (restart intervals)
+			size_t*					SegBlock = nullptr;												//  Block index of each EEB
+			size_t					SX = 0;															//  Segment index
+			std::atomic<bool>		Truncated(false);												//  A segment ran short
+
+			//  Count the EEBs (restart intervals) that follow the scan header
+			while ((BlockNo + BlocksConsumed) < Map.NumBlocks) {
+				if (Map.Blocks[BlockNo + BlocksConsumed].BlockType == JFIF_BLOCK_EEB) Segments++;
+				else if (Map.Blocks[BlockNo + BlocksConsumed].BlockType != JFIF_BLOCK_RST) break;
+				BlocksConsumed++;
+			}
+			if (Skip || Segments == 0) return BlocksConsumed;
+
+			//  Validate the scan parameters
+			if (Ns < 1 || Ns > 3 || Ss > Se || Se > 63 || (Ss == 0 && Se != 0) || (Ss > 0 && Ns != 1) || Al > 13) {
+				std::cerr << "ERROR: JPEG progressive scan has invalid parameters, skipping scan." << std::endl;
+				return BlocksConsumed;
+			}
+
+			//  Map the scan components to the frame components and make sure the entropy decoders are available
+			for (size_t CX = 0; CX < Ns; CX++) {
+				for (SC[CX] = 0; SC[CX] < 3; SC[CX]++) if (pSOF->Comp[SC[CX]].CompID == pSH->Comp[CX].ScanSelector) break;
+				if (SC[CX] == 3 ||
+					(Ss == 0 && Ah == 0 && ResDir.pHTDC[GetDCSelector(pSH->Comp[CX].DCandAC)] == nullptr) ||
+					(Ss > 0 && ResDir.pHTAC[GetACSelector(pSH->Comp[CX].DCandAC)] == nullptr)) {
+					std::cerr << "ERROR: JPEG progressive scan references an undefined component or table, skipping scan." << std::endl;
+					return BlocksConsumed;
+				}
+			}
+
+			//  Interleaved scans are in MCU order, a single component scan covers only the DUs within the frame
+			if (Ns > 1) Units = Coeffs.MCUCols * Coeffs.MCURows;
+			else Units = Coeffs.BW[SC[0]] * Coeffs.BH[SC[0]];
+
+			//  Locate the EEB for each restart interval
+			SegBlock = new size_t[Segments];
+			for (size_t BX = BlockNo + 1; BX < (BlockNo + BlocksConsumed); BX++) {
+				if (Map.Blocks[BX].BlockType == JFIF_BLOCK_EEB) SegBlock[SX++] = BX;
+			}
+
+			//  Decode the intervals
+			WorkGang::run(Segments, [&](size_t SegNo) {
+				Huffman					EDC;														//  Entropy Decoder
+				size_t					FirstUnit = 0;												//  First unit in the interval
+				size_t					LastUnit = Units;											//  Unit following the interval
+				int						PreviousDC[3] = {};											//  DC predictors (by scan component)
+				uint32_t				EOBRun = 0;													//  Remaining end-of-band run
+				DU*						pDU = nullptr;												//  DU being decoded
+				size_t					MR = 0;														//  MCU row
+				size_t					MC = 0;														//  MCU column
+
+				if (ResDir.RestartInterval > 0) {
+					FirstUnit = SegNo * ResDir.RestartInterval;
+					LastUnit = FirstUnit + ResDir.RestartInterval;
+					if (LastUnit > Units || SegNo == (Segments - 1)) LastUnit = Units;
+				}
+				else if (SegNo > 0) return;
+				if (FirstUnit >= Units) return;
+
+				StuffedStream				bsIn(Map.Blocks[SegBlock[SegNo]].Block, Map.Blocks[SegBlock[SegNo]].BlockSize);
+				Huffman::JPEGScanReader		Reader = EDC.readJPEGScan(bsIn);
+
+				for (size_t UX = FirstUnit; UX < LastUnit; UX++) {
+					if (Ns == 1) {
+						pDU = coefficientDU(Coeffs, SC[0], UX / Coeffs.BW[SC[0]], UX % Coeffs.BW[SC[0]]);
+						if (!decodeProgressiveDU(Reader, ResDir, pSH->Comp[0].DCandAC, *pDU, PreviousDC[0], EOBRun, Ss, Se, Ah, Al)) {
+							Truncated = true;
+							return;
+						}
+						continue;
+					}
+
+					//  Interleaved DC scan, each component contributes its DUs to the MCU
+					MR = UX / Coeffs.MCUCols;
+					MC = UX % Coeffs.MCUCols;
+					for (size_t CX = 0; CX < Ns; CX++) {
+						for (size_t DUR = 0; DUR < size_t(Coeffs.VSF[SC[CX]]); DUR++) {
+							for (size_t DUC = 0; DUC < size_t(Coeffs.HSF[SC[CX]]); DUC++) {
+								pDU = coefficientDU(Coeffs, SC[CX], (MR * size_t(Coeffs.VSF[SC[CX]])) + DUR, (MC * size_t(Coeffs.HSF[SC[CX]])) + DUC);
+								if (!decodeProgressiveDU(Reader, ResDir, pSH->Comp[CX].DCandAC, *pDU, PreviousDC[CX], EOBRun, Ss, Se, Ah, Al)) {
+									Truncated = true;
+									return;
+								}
+							}
+						}
+					}
+				}
+			});
+
+			if (Truncated) std::cerr << "ERROR: JPEG progressive scan has terminated before filling its DUs." << std::endl;
+
+			delete[] SegBlock;
+
+			//  Return the number of blocks consumed
+			return BlocksConsumed;
+		}
+
+		//  decodeProgressiveDU
+		//
+		//  This static function will decode the contribution of a progressive scan to a single DU
+		//
+		//  PARAMETERS
+		//
+		//		JPEGScanReader&			-		Reference to the scan reader
+		//		JRD&					-		Reference to the resource directory
+		//		BYTE					-		Entropy table selectors of the scan component
+		//		DU&						-		Reference to the DU to be updated
+		//		int&					-		Reference to the DC predictor of the component
+		//		uint32_t&				-		Reference to the remaining end-of-band run
+		//		int						-		Start of spectral selection
+		//		int						-		End of spectral selection
+		//		int						-		Previous approximation bit position (0 for a first scan)
+		//		int						-		Approximation bit position
+		//
+		//  RETURNS
+		//
+		//		bool					-		true if the DU was decoded, false if the stream ran short or is invalid
+		//
+		//  NOTES
+		//
+		//  Follows the decoding procedures of ITU-T T.81 G.2, the coefficients are held in zig-zag order.
+		//
+
+		static bool		decodeProgressiveDU(Huffman::JPEGScanReader& Reader, JRD& ResDir, BYTE Selectors, DU& Unit, int& PreviousDC, uint32_t& EOBRun, int Ss, int Se, int Ah, int Al) {
+			BYTE			RS = 0;																	//  Run length & size symbol
+			int				Run = 0;																//  Run of zero coefficients
+			int				Size = 0;																//  Coefficient size (or correction)
+			int				K = Ss;																	//  Coefficient index (zig-zag)
+			int				P1 = 1 << Al;															//  Positive correction
+			int				M1 = -P1;																//  Negative correction
+			int16_t*		pCoeff = nullptr;														//  Coefficient being refined
+
+			//  DC first scan, the difference is added to the predictor and scaled to the approximation
+			if (Ss == 0 && Ah == 0) {
+				Reader.setTree(ResDir.pHTDC[GetDCSelector(Selectors)]);
+				if (!Reader.nextSymbol(RS) || RS > 15) return false;
+				PreviousDC += Reader.readCoefficient(RS);
+				Unit.DC = int16_t(PreviousDC * P1);
+				return true;
+			}
+
+			//  DC refinement, one bit per DU
+			if (Ss == 0) {
+				if (Reader.readBits(1)) Unit.DC = int16_t(Unit.DC | P1);
+				return true;
+			}
+
+			//  AC first scan
+			if (Ah == 0) {
+				if (EOBRun > 0) {
+					EOBRun--;
+					return true;
+				}
+				Reader.setTree(ResDir.pHTAC[GetACSelector(Selectors)]);
+				for (K = Ss; K <= Se; K++) {
+					if (!Reader.nextSymbol(RS)) return false;
+					Run = RS >> 4;
+					Size = RS & 0x0F;
+					if (Size != 0) {
+						K += Run;
+						if (K > Se) return false;
+						Unit.AC[K - 1] = int16_t(Reader.readCoefficient(Size) * P1);
+					}
+					else if (Run == 15) K += 15;
+					else {
+						//  End of band run, this DU is the first of the run
+						EOBRun = uint32_t(1) << Run;
+						if (Run > 0) EOBRun += Reader.readBits(uint32_t(Run));
+						EOBRun--;
+						break;
+					}
+				}
+				return true;
+			}
+
+			//  AC refinement, correction bits are interleaved with the newly significant coefficients
+			if (EOBRun == 0) {
+				Reader.setTree(ResDir.pHTAC[GetACSelector(Selectors)]);
+				for (; K <= Se; K++) {
+					if (!Reader.nextSymbol(RS)) return false;
+					Run = RS >> 4;
+					Size = RS & 0x0F;
+					if (Size != 0) {
+						if (Size != 1) return false;
+						Size = Reader.readBits(1) ? P1 : M1;
+					}
+					else if (Run != 15) {
+						EOBRun = uint32_t(1) << Run;
+						if (Run > 0) EOBRun += Reader.readBits(uint32_t(Run));
+						break;
+					}
+
+					//  Skip the run of zero coefficients, refining the non-zero ones that are passed over
+					do {
+						pCoeff = &Unit.AC[K - 1];
+						if (*pCoeff != 0) {
+							if (Reader.readBits(1) && (*pCoeff & P1) == 0) *pCoeff = int16_t(*pCoeff + ((*pCoeff >= 0) ? P1 : M1));
+						}
+						else {
+							if (--Run < 0) break;
+						}
+						K++;
+					} while (K <= Se);
+
+					if (Size != 0) {
+						if (K > Se) return false;
+						Unit.AC[K - 1] = int16_t(Size);
+					}
+				}
+			}
+
+			//  Within an end of band run only the non-zero coefficients are refined
+			if (EOBRun > 0) {
+				for (; K <= Se; K++) {
+					pCoeff = &Unit.AC[K - 1];
+					if (*pCoeff != 0) {
+						if (Reader.readBits(1) && (*pCoeff & P1) == 0) *pCoeff = int16_t(*pCoeff + ((*pCoeff >= 0) ? P1 : M1));
+					}
+				}
+				EOBRun--;
+			}
+
+			//  Return to caller
+			return true;
+		}
+
+		//  coefficientDU
+		//
+		//  This static function returns the address of a DU in the coefficient buffers
+		//
+		//  PARAMETERS
+		//
+		//		COEFFS&			-		Reference to the coefficient buffers
+		//		size_t			-		Component index
+		//		size_t			-		DU row (within the component)
+		//		size_t			-		DU column (within the component)
+		//
+		//  RETURNS
+		//
+		//		DU*				-		Pointer to the DU
+		//
+		//  NOTES
+		//
+		//  The DUs of a component are stored in the sequence that they are consumed by the MCUs, left to right and
+		//  top to bottom within each MCU.
+		//
+
+		static DU*		coefficientDU(COEFFS& Coeffs, size_t CX, size_t DUR, size_t DUC) {
+			size_t			H = size_t(Coeffs.HSF[CX]);												//  Horizontal DUs per MCU
+			size_t			V = size_t(Coeffs.VSF[CX]);												//  Vertical DUs per MCU
+			size_t			MX = ((DUR / V) * Coeffs.MCUCols) + (DUC / H);							//  MCU index
+
+			return Coeffs.pDUs[CX] + (MX * H * V) + ((DUR % V) * H) + (DUC % H);
+		}
+
+		//  replayCoefficients
+		//
+		//  This static function will decode the accumulated coefficients of a progressive frame into the component planes
+		//
+		//  PARAMETERS
+		//
+		//		COEFFS&					-		Const reference to the coefficient buffers
+		//		JRD&					-		Reference to the resource directory
+		//		JFIF_FRAME_HEADER*		-		Pointer to the Start of Frame block
+		//		CPLANES&				-		Reference to the component planes to be populated
+		//		SWITCHES				-		Options for loading the image
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  Each MCU row of the region is an independent task with its own pipeline, the dequantization and IDCT are
+		//  performed once per DU after all of the scans have been decoded.
+		//
 
-			for (RasterBuffer<RGB>::iterator It = pRB->firstMCU(ResDir.MCUFF); It != pRB->lastMCU(ResDir.MCUFF); It++) {
-				if (Sink.hasNext()) {
-					*It = ColourConverter::convertToRGB(Sink.next());
-				}
-				else {
-					std::cerr << "ERROR: JPEG decoding stream has terminated before filling an image buffer." << std::endl;
-					break;
-				}
-			}
+		static void		replayCoefficients(const COEFFS& Coeffs, JRD& ResDir, JFIF_FRAME_HEADER* pSOF, CPLANES& Planes, SWITCHES Opts) {
 
-			//  If the extracted image was larger than the actual image size (MCU boundaries) then resize the image
-			if (ScanH > FrameH || ScanW > FrameW) {
-				SizeVector		svCrop = {};
+			WorkGang::run((Planes.MCUReg.Bottom - Planes.MCUReg.Top) + 1, [&](size_t Row) {
+				DecoderPipeline			Pipe;														//  Decoder Pipeline
+				size_t					MR = Planes.MCUReg.Top + Row;								//  MCU row
+				size_t					FirstMCU = (MR * Planes.MCUCols) + Planes.MCUReg.Left;		//  First MCU of the row in the region
+				size_t					LastMCU = (MR * Planes.MCUCols) + Planes.MCUReg.Right + 1;	//  MCU following the row in the region
+				const DU*				pStart[3] = {};												//  First DU to replay (by component)
 
-				svCrop.Bottom = int(FrameH - ScanH);
-				svCrop.Right = int(FrameW - ScanW);
+				conditionDecoder(Pipe, ResDir, pSOF, nullptr, Opts);
 
-				pRB->resize(svCrop, nullptr);
-			}
+				for (size_t CX = 0; CX < 3; CX++) pStart[CX] = Coeffs.pDUs[CX] + (FirstMCU * size_t(Coeffs.HSF[CX] * Coeffs.VSF[CX]));
+				DecoderPipeline::Emitter	Sink = Pipe.replay(pStart);
 
-			//  Create a frame to carry the Raster Buffer and append it to the train
-			pTrain->append(new Frame<RGB>(pRB, 0, 0, nullptr));
+				decodeMCUs(Pipe, Sink, Planes, FirstMCU, LastMCU);
+			});
 
-			//  Return the number of blocks consumed
-			return BlocksConsumed;
+			//  Return to caller
+			return;
 		}
 
 		//  skipFrame
@@ -4245,6 +6928,9 @@ namespace xymorg {
 				size_t				Precision = GetPrecision(*pNextTable);						//  Precision of the next table
 				size_t				QX = GetDestination(*pNextTable);							//  The identifying destination
 
+				//  A truncated 16 bit table ends the block
+				if (Precision != 0 && Residue < sizeof(JFIF_QV16_ARRAY)) break;
+
 				//  If the table is already in use then delete the existing incumbent
 				if (QX <= 3) {
 					if (ResDir.pQ[QX] != nullptr) delete ResDir.pQ[QX];
@@ -4289,6 +6975,12 @@ namespace xymorg {
 			JFIF_HTAB*		pHT = (JFIF_HTAB*) Map.Blocks[BlockNo].Block;							//  Pointer to the definition table block
 			size_t			Class = GetClass(pHT->CandD);											//  Class (AC or DC)
 			size_t			HX = GetDestination(pHT->CandD);										//  The identifying destination
+			size_t			Symbols = 0;															//  Count of symbols in the table
+
+			//  The table lengths and symbols must be within the block
+			if (Map.Blocks[BlockNo].BlockSize < 21) return;
+			for (size_t LX = 0; LX < 16; LX++) Symbols += pHT->HTL[LX];
+			if (Map.Blocks[BlockNo].BlockSize < (21 + Symbols)) return;
 
 			//  DC Class Table
 			if (HX <= 3) {
@@ -4304,8 +6996,458 @@ namespace xymorg {
 					//  If this resource is already allocated then delete the existing instantiation
 					if (ResDir.pHTAC[HX] != nullptr) delete ResDir.pHTAC[HX];
 
-					//  Build a new DC Huffman Tree for the selected destination
-					ResDir.pHTAC[HX] = new JPEGHuffmanTree(*pHT);
+					//  Build a new DC Huffman Tree for the selected destination
+					ResDir.pHTAC[HX] = new JPEGHuffmanTree(*pHT);
+				}
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  addRestartInterval
+		//
+		//  This static function will record the restart interval in the resource directory
+		//
+		//  PARAMETERS
+		//
+		//		Map&					-		Reference to the map of the in-memory image
+		//		size_t					-		Block index of the DRI block
+		//		JRD&					-		Reference to the resource directory
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+
+		static void		addRestartInterval(ODIMap& Map, size_t BlockNo, JRD& ResDir) {
+			JFIF_DRI_BLOCK*		pDRI = (JFIF_DRI_BLOCK*) Map.Blocks[BlockNo].Block;					//  Pointer to the DRI block
+
+			if (Map.Blocks[BlockNo].BlockSize < 6) return;
+			ResDir.RestartInterval = GetSizeBE(pDRI->Interval);
+
+			//  Return to caller
+			return;
+		}
+
+		//  serialiseTrain
+		//
+		//  This static function will write a JFIF/JPEG image of the passed source image to the passed sink.
+		//
+		//  PARAMETERS
+		//
+		//		JSOURCE&		-		Reference to the source image
+		//		ResourceSink&	-		Reference to the sink that receives the image
+		//		SWITCHES		-		Options to use for storing the image
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the complete image was written to the sink, otherwise false
+		//
+		//  NOTES
+		//
+		//		The headers are built in a small staging buffer, the Entropy Encoded Block is streamed to the sink
+		//		as it is encoded so the complete image is never held in memory.
+		//
+
+		static bool		serialiseTrain(JSOURCE& Src, ResourceSink& Out, SWITCHES Opts) {
+			BYTE*					pImage = nullptr;											//  Header staging buffer
+			size_t					ImgUsed = 0;												//  Bytes used in the staging buffer
+			size_t					ImgEst = 0;													//  (Over) Estimated size of the headers
+			JRD						ResDir = {};												//  Resource Directory
+			DU*						pDUs = nullptr;												//  Captured DUs (two pass encoding)
+			
+			//  Allocate the staging buffer for the headers
+			ImgEst = 4096 + (256 * sizeof(YCbCr)) + ((size_t(64) * size_t(3)) + (size_t(256) * size_t(6)));
+			pImage = (BYTE*) calloc(1, ImgEst);
+			if (pImage == nullptr) return false;
+
+			//  Select the resources to use for image encoding (Quantisation tables and Huffman Trees)
+			selectResources(Src, ResDir, Opts);
+
+			//  Append the file header to the image
+			appendFileHeader(pImage, ImgUsed);
+
+			//  Appent the Basic (APP0) header
+			appendBasicHeader(pImage, ImgUsed);
+
+			//  Append the Quantisation Tables used
+			appendQuantisationTables(pImage, ImgUsed, ResDir);
+
+			//  Append Start Of Frame (SOF0)
+			appendStartOfFrame(Src, pImage, ImgUsed, ResDir, Opts);
+
+			//  Two pass encoding, capture the quantized DUs and replace the default Huffman Trees with optimised ones
+			if (Opts & JFIF_STORE_OPT_OPTIMISE) {
+				if (Opts & JFIF_STORE_OPT_RESTART) ResDir.RestartInterval = restartInterval(Src, ResDir, Opts);
+				pDUs = captureImage(Src, ResDir, Opts);
+				if (pDUs != nullptr) optimiseHuffmanTrees(Src, ResDir, pDUs);
+			}
+
+			//  Append the Huffman Tree Table definitions that will be used
+			appendHuffmanTrees(pImage, ImgUsed, ResDir, Opts);
+
+			//  Append the Define Restart Interval block (if requested)
+			if (Opts & JFIF_STORE_OPT_RESTART) appendRestartInterval(Src, pImage, ImgUsed, ResDir, Opts);
+
+			//  Append the Start Of Scan block
+			appendStartOfScan(pImage, ImgUsed, ResDir, Opts);
+
+			//  Write the headers and stream the Entropy Encoded Block (Image), the trailer is only written to a complete image
+			if (Out.write(pImage, ImgUsed) && appendImage(Src, Out, ResDir, pDUs, Opts)) {
+				ImgUsed = 0;
+				appendFileTrailer(pImage, ImgUsed);
+				Out.write(pImage, ImgUsed);
+			}
+			if (pDUs != nullptr) free(pDUs);
+			free(pImage);
+
+			//
+			//  Purge the accumulated resources from the directory
+			//
+
+			for (int CX = 0; CX < 3; CX++) {
+
+				if (ResDir.pQ[CX] != nullptr) {
+					if (!ResDir.SharedQ) delete ResDir.pQ[CX];
+					if (ResDir.pQ[CX + 1] == ResDir.pQ[CX]) ResDir.pQ[CX + 1] = nullptr;
+					ResDir.pQ[CX] = nullptr;
+				}
+
+				if (ResDir.pHTDC[CX] != nullptr) {
+					delete ResDir.pHTDC[CX];
+					if (ResDir.pHTDC[CX + 1] == ResDir.pHTDC[CX]) ResDir.pHTDC[CX + 1] = nullptr;
+					ResDir.pHTDC[CX] = nullptr;
+				}
+
+				if (ResDir.pHTAC[CX] != nullptr) {
+					delete ResDir.pHTAC[CX];
+					if (ResDir.pHTAC[CX + 1] == ResDir.pHTAC[CX]) ResDir.pHTAC[CX + 1] = nullptr;
+					ResDir.pHTAC[CX] = nullptr;
+				}
+			}
+
+			//  Return showing if the image was written
+			return !Out.hasFailed();
+		}
+
+		//  appendImage
+		//
+		//  This static function will stream the Entropy Encoded Block (Image) to the sink
+		//
+		//  PARAMETERS
+		//
+		//		JSOURCE&		-		Reference to the source image
+		//		ResourceSink&	-		Reference to the sink that receives the image
+		//		JRD&			-		Reference to the JPEG Resource Directory
+		//		DU*				-		Const pointer to the captured DUs of the image (or nullptr)
+		//		SWITCHES		-		Options array
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the complete image was written to the sink, otherwise false
+		//
+		//  NOTES
+		//
+		//  When the DUs of the image have been captured they are entropy encoded directly, the source image is not used.
+		//
+
+		static bool		appendImage(JSOURCE& Src, ResourceSink& Out, JRD& ResDir, const DU* pDUs, SWITCHES Opts) {
+
+			//  Restart intervals are encoded as independent strips
+			if (ResDir.RestartInterval > 0) return appendRestartIntervals(Src, Out, ResDir, pDUs, Opts);
+
+			SinkStream				bsOut(Out);														//  Output stream (in place in the sink)
+			EncoderPipeline			Pipe;															//  Encoder Pipeline
+			Huffman					EEC;															//  Entropy Encoder
+			size_t					MCUs = (Src.ScanH / (size_t(ResDir.MCUFF & 0x0F) * 8)) * (Src.ScanW / (size_t(ResDir.MCUFF >> 4) * 8));	//  MCUs in the image
+
+			//  Prepare the pipeline for encoding the frame
+			conditionEncoder(Pipe, ResDir, Opts);
+
+			//
+			//  Arrange the plumbing for the input and output:
+			//
+			//		RasterBuffer  ==> Pipeline::Collecter ==> Pipeline ==> Huffman::Collecter ==> StuffedStream
+			//
+
+			Huffman::JPEGCollecter		Sink = EEC.encodeJPEG(bsOut);
+
+			if (pDUs != nullptr) Pipe.replay(&Sink, pDUs, MCUs);
+			else {
+				EncoderPipeline::Collecter	Source = Pipe.encode(&Sink, ResDir.MCUFF);
+
+				//  Feed the source image to the pipeline collecter, one MCU at a time in MCU sequence
+				encodeMCUs(Source, Src, ResDir, 0, MCUs);
+
+				//  Signal end of the pixel stream to the pipeline
+				Source.signalEndOfStream();
+			}
+
+			//  Write the remainder of the window
+			bsOut.flush();
+
+			//  Return showing if the image was written
+			return !Out.hasFailed();
+		}
+
+		//  appendRestartIntervals
+		//
+		//  This static function will stream the Entropy Encoded Block (Image) to the sink as a sequence of restart intervals
+		//
+		//  PARAMETERS
+		//
+		//		JSOURCE&		-		Reference to the source image
+		//		ResourceSink&	-		Reference to the sink that receives the image
+		//		JRD&			-		Reference to the JPEG Resource Directory
+		//		DU*				-		Const pointer to the captured DUs of the image (or nullptr)
+		//		SWITCHES		-		Options array
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if all of the intervals were written to the sink, otherwise false
+		//
+		//  NOTES
+		//
+		//  Each interval (strip) is encoded by its own pipeline with the DC predictors starting from zero, the strips
+		//  are encoded concurrently and then written to the sink separated by RST0 - RST7 markers (modulo 8). Strips
+		//  are encoded in batches of two per worker so that only a batch of encoded strips is held in memory.
+		//  A strip that could not be encoded fails the sink, an image with missing intervals is never completed.
+		//
+
+		static bool		appendRestartIntervals(JSOURCE& Src, ResourceSink& Out, JRD& ResDir, const DU* pDUs, SWITCHES Opts) {
+			size_t					MCUBytes = size_t(ResDir.MCUFF >> 4) * size_t(ResDir.MCUFF & 0x0F) * 64;	//  Pixels in an MCU
+			size_t					MCUDUs = duPerMCU(ResDir);										//  DUs in an MCU
+			size_t					MCUs = (Src.ScanH / (size_t(ResDir.MCUFF & 0x0F) * 8)) * (Src.ScanW / (size_t(ResDir.MCUFF >> 4) * 8));	//  MCUs in the image
+			size_t					Strips = (MCUs + ResDir.RestartInterval - 1) / ResDir.RestartInterval;	//  Number of intervals
+			size_t					Batch = 2 * WorkGang::workers();								//  Strips encoded per batch
+			BYTE**					pStrip = new BYTE*[Batch];										//  Encoded strips (batch)
+			size_t*					StripSize = new size_t[Batch];									//  Encoded strip sizes (batch)
+			BYTE					RST[2] = { JFIF_BLKID_SIG, 0 };									//  Restart marker
+			bool					Written = true;													//  All strips written
+
+			for (size_t FirstSX = 0; FirstSX < Strips && Written; FirstSX += Batch) {
+				size_t					BatchStrips = (Strips - FirstSX) < Batch ? (Strips - FirstSX) : Batch;	//  Strips in this batch
+
+				//  Encode the strips of the batch
+				WorkGang::run(BatchStrips, [&](size_t BX) {
+					size_t					SX = FirstSX + BX;											//  Strip number
+					size_t					FirstMCU = SX * ResDir.RestartInterval;						//  First MCU in the strip
+					size_t					LastMCU = FirstMCU + ResDir.RestartInterval;				//  MCU following the strip
+					EncoderPipeline			Pipe;														//  Encoder Pipeline
+					Huffman					EEC;														//  Entropy Encoder
+
+					if (LastMCU > MCUs) LastMCU = MCUs;
+					StuffedStream			bsOut(2 * MCUBytes * (LastMCU - FirstMCU), MCUBytes * (LastMCU - FirstMCU));
+
+					conditionEncoder(Pipe, ResDir, Opts);
+
+					Huffman::JPEGCollecter		Sink = EEC.encodeJPEG(bsOut);
+
+					if (pDUs != nullptr) Pipe.replay(&Sink, pDUs + (FirstMCU * MCUDUs), LastMCU - FirstMCU);
+					else {
+						EncoderPipeline::Collecter	Source = Pipe.encode(&Sink, ResDir.MCUFF);
+
+						encodeMCUs(Source, Src, ResDir, FirstMCU, LastMCU);
+						Source.signalEndOfStream();
+					}
+					pStrip[BX] = bsOut.acquireBuffer(StripSize[BX]);
+				});
+
+				//  Write the strips of the batch separated by restart markers, the strips are freed whether written or not
+				for (size_t BX = 0; BX < BatchStrips; BX++) {
+					size_t					SX = FirstSX + BX;											//  Strip number
+
+					if (pStrip[BX] == nullptr) Written = false;
+					else {
+						if (Written && !Out.write(pStrip[BX], StripSize[BX])) Written = false;
+						free(pStrip[BX]);
+					}
+
+					if (Written && SX < (Strips - 1)) {
+						RST[1] = BYTE(JFIF_BLKID_RST0 + (SX & 7));
+						if (!Out.write(RST, 2)) Written = false;
+					}
+				}
+			}
+
+			delete[] pStrip;
+			delete[] StripSize;
+
+			//  A missing strip leaves the sink failed
+			if (!Written) Out.fail();
+			return Written;
+		}
+
+		//  encodeMCUs
+		//
+		//  This static function is the input stage of the encoder, it feeds a range of MCUs from the source image into
+		//  an encoder pipeline
+		//
+		//  PARAMETERS
+		//
+		//		Collecter&				-		Reference to the encoder pipeline collecter
+		//		JSOURCE&				-		Const reference to the source image
+		//		JRD&					-		Const reference to the JPEG Resource Directory
+		//		size_t					-		Index of the first MCU to encode
+		//		size_t					-		Index of the MCU following the last one to encode
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  MCUs are numbered left to right, top to bottom. Each MCU row is converted and downsampled into a band of
+		//  component planes and the MCUs are then taken from the band.
+		//
+
+		static void		encodeMCUs(EncoderPipeline::Collecter& Source, const JSOURCE& Src, const JRD& ResDir, size_t FirstMCU, size_t LastMCU) {
+			size_t			MCUCols = Src.ScanW / (size_t(Src.MCUFF >> 4) * 8);					//  MCUs in each row
+			CPLANES			Band = {};																//  Component planes for one MCU row
+			BYTE*			pFull = nullptr;														//  Full resolution component rows
+			size_t			BandRow = 0;															//  MCU row held in the band
+			MCU				Tile = {};																//  Planar MCU
+
+			if (FirstMCU >= LastMCU) return;
+
+			//  Setup the band
+			Band.Height = size_t(Src.MCUFF & 0x0F) * 8;
+			Band.Width = Src.ScanW;
+			Band.MCUFF = Src.MCUFF;
+			for (size_t CX = 0; CX < 3; CX++) {
+				Band.HSF[CX] = ResDir.HSF[CX];
+				Band.VSF[CX] = ResDir.VSF[CX];
+				Band.PH[CX] = size_t(Band.VSF[CX]) * 8;
+				Band.PW[CX] = MCUCols * size_t(Band.HSF[CX]) * 8;
+				Band.Plane[CX] = new BYTE[Band.PH[CX] * Band.PW[CX]];
+			}
+			pFull = new BYTE[3 * Band.Height * Band.Width];
+
+			BandRow = FirstMCU / MCUCols;
+			buildBand(Src, BandRow, Band, pFull);
+
+			for (size_t MX = FirstMCU; MX < LastMCU; MX++) {
+				if ((MX / MCUCols) != BandRow) {
+					BandRow = MX / MCUCols;
+					buildBand(Src, BandRow, Band, pFull);
+				}
+				loadMCU(Band, Tile, MX % MCUCols);
+				Source.nextMCU(Tile);
+			}
+
+			for (size_t CX = 0; CX < 3; CX++) delete[] Band.Plane[CX];
+			delete[] pFull;
+
+			//  Return to caller
+			return;
+		}
+
+		//  buildBand
+		//
+		//  This static function will convert one MCU row of the source image to YCbCr and downsample it into a band of
+		//  component planes
+		//
+		//  PARAMETERS
+		//
+		//		JSOURCE&		-		Const reference to the source image
+		//		size_t			-		MCU row number
+		//		CPLANES&		-		Reference to the band to be populated
+		//		BYTE*			-		Pointer to a work area (3 x band height x scan width)
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  Rows and columns beyond the image repeat the last row and column. A subsampled component is the (rounded)
+		//  average of the samples that it covers.
+		//
+
+		static void		buildBand(const JSOURCE& Src, size_t MR, CPLANES& Band, BYTE* pFull) {
+			size_t			SRow = 0;																//  Source row
+			BYTE*			pRow[3] = {};															//  Full resolution component rows
+
+			//  Convert the rows of the band to full resolution component planes
+			for (size_t RX = 0; RX < Band.Height; RX++) {
+				SRow = (MR * Band.Height) + RX;
+				if (SRow >= Src.Height) SRow = Src.Height - 1;
+
+				for (size_t CX = 0; CX < 3; CX++) pRow[CX] = pFull + (((CX * Band.Height) + RX) * Band.Width);
+				ColourConverter::convertRowToYCbCr(Src.pRB->getPixel(SRow, 0), pRow[0], pRow[1], pRow[2], Src.Width);
+				for (size_t CX = 0; CX < 3; CX++) {
+					if (Src.ScanW > Src.Width) memset(pRow[CX] + Src.Width, pRow[CX][Src.Width - 1], Src.ScanW - Src.Width);
+				}
+			}
+
+			//  Reduce each component to its sampling resolution
+			for (size_t CX = 0; CX < 3; CX++) {
+				size_t			HR = size_t(Band.MCUFF >> 4) / size_t(Band.HSF[CX]);		//  Horizontal ratio
+				size_t			VR = size_t(Band.MCUFF & 0x0F) / size_t(Band.VSF[CX]);	//  Vertical ratio
+				const BYTE*		pIn = pFull + (CX * Band.Height * Band.Width);			//  Full resolution plane
+				BYTE*			pOut = Band.Plane[CX];										//  Component plane
+
+				for (size_t RX = 0; RX < Band.PH[CX]; RX++) {
+					const BYTE*		pTop = pIn + ((RX * VR) * Band.Width);
+					const BYTE*		pBottom = pTop + ((VR - 1) * Band.Width);
+
+					if (HR == 1 && VR == 1) memcpy(pOut, pTop, Band.PW[CX]);
+					else if (HR == 1) {
+						for (size_t SX = 0; SX < Band.PW[CX]; SX++) pOut[SX] = BYTE((int(pTop[SX]) + int(pBottom[SX]) + 1) >> 1);
+					}
+					else {
+						for (size_t SX = 0; SX < Band.PW[CX]; SX++) {
+							int		Sum = int(pTop[SX * 2]) + int(pTop[(SX * 2) + 1]) + int(pBottom[SX * 2]) + int(pBottom[(SX * 2) + 1]);
+
+							if (VR == 1) Sum *= 2;
+							pOut[SX] = BYTE((Sum + 2) >> 2);
+						}
+					}
+					pOut += Band.PW[CX];
+				}
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  loadMCU
+		//
+		//  This static function will load the DUs of an MCU from a band of component planes
+		//
+		//  PARAMETERS
+		//
+		//		CPLANES&		-		Const reference to the band
+		//		MCU&			-		Reference to the MCU to be populated
+		//		size_t			-		Index of the MCU within the band
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  The DU layout is the same as the one used by storeMCU(), only the DUs within the sampling of each component
+		//  are populated.
+		//
+
+		static void		loadMCU(const CPLANES& Band, MCU& Tile, size_t MX) {
+			int16_t			Samples[64] = {};														//  DU samples (natural order)
+			DU*				pDUs = nullptr;															//  DUs of the component
+			const BYTE*		pIn = nullptr;															//  Input row
+
+			memset(&Tile, 0, sizeof(MCU));
+
+			for (size_t CX = 0; CX < 3; CX++) {
+				if (CX == 0) pDUs = Tile.DUY;
+				else if (CX == 1) pDUs = Tile.DUCb;
+				else pDUs = Tile.DUCr;
+
+				for (size_t DUR = 0; DUR < size_t(Band.VSF[CX]); DUR++) {
+					for (size_t DUC = 0; DUC < size_t(Band.HSF[CX]); DUC++) {
+						for (size_t RX = 0; RX < 8; RX++) {
+							pIn = Band.Plane[CX] + (((DUR * 8) + RX) * Band.PW[CX]) + (((MX * size_t(Band.HSF[CX])) + DUC) * 8);
+							for (size_t CoX = 0; CoX < 8; CoX++) Samples[(RX * 8) + CoX] = pIn[CoX];
+						}
+
+						//  A DU is the DC sample followed by the 63 AC samples
+						memcpy(&pDUs[(DUR * 2) + DUC], Samples, sizeof(DU));
+					}
 				}
 			}
 
@@ -4313,247 +7455,320 @@ namespace xymorg {
 			return;
 		}
 
-		//  buildCanonicalTrain
+		//  duPerMCU
 		//
-		//  This static function will build a Canonical Train (Writeable) from the passed Train
+		//  This static function will return the number of DUs in each MCU of the image
 		//
 		//  PARAMETERS
 		//
-		//		Train*			-		Pointer to the input train
-		//		SWITCHES		-		Optins to use for forming the Canonical Train
+		//		JRD&			-		Const reference to the JPEG Resource Directory
 		//
 		//  RETURNS
 		//
-		//		Train*			-		Pointer to the constructed Canonical Train
+		//		size_t			-		DUs in each MCU (all components)
 		//
 		//  NOTES
 		//
 
-		static Train<YCbCr>* buildCanonicalTrain(Train<RGB>* pTrain, SWITCHES Opts) {
-			Train<RGB>*				pITrain = nullptr;														//  Flattened Image
-			Train<YCbCr>*			pCTrain = nullptr;														//  YCbCr version
-			YCbCr					Background =  ColourConverter::convertToYCbCr(pTrain->getBackGround()); //  Background colour
-			Frame<RGB>*				pIFrame = nullptr;														//  Source frame
-			size_t					IH = 0;																	//  Input Height
-			size_t					IW = 0;																	//  Input Width
-			size_t					OH = 0;																	//  Output Height
-			size_t					OW = 0;																	//  Output Width
-			RasterBuffer<YCbCr>*	pNewRB = nullptr;														//  Target Raster Buffer
-			YCbCr					LastPixel = {};															//  Last pixel converted
-			BYTE					MCUFF = 0;																//  MCU Form Factor
+		static size_t	duPerMCU(const JRD& ResDir) {
+			size_t			DUs = 0;																//  DUs in the MCU
+
+			for (size_t CX = 0; CX < 3; CX++) DUs += size_t(ResDir.HSF[CX]) * size_t(ResDir.VSF[CX]);
 
-			//  Determine the MCU Form Factor to use
-			if (Opts & JFIF_STORE_OPT_HIFI) MCUFF = 0x11;
-			else MCUFF = 0x22;
+			//  Return the count
+			return DUs;
+		}
 
-			//  For JPEG images the canonical image is a flattened copy of the input train
-			pITrain = new Train<RGB>(*pTrain);
-			pITrain->flatten();
+		//  captureImage
+		//
+		//  This static function is the first pass of two pass encoding, it captures the quantized DUs of the image
+		//
+		//  PARAMETERS
+		//
+		//		JSOURCE&		-		Const reference to the source image
+		//		JRD&			-		Reference to the JPEG Resource Directory
+		//		SWITCHES		-		Options array
+		//
+		//  RETURNS
+		//
+		//		DU*				-		Pointer to the captured DUs (in encoding sequence), nullptr if not available
+		//
+		//  NOTES
+		//
+		//  The caller is responsible for freeing the returned buffer. Bands of MCU rows are captured concurrently, the
+		//  second pass entropy encodes the captured DUs so the FDCT is only run once.
+		//
 
-			//  Form the output train in the YCbCr colour space
-			pCTrain = new Train<YCbCr>(pTrain->getCanvasHeight(), pTrain->getCanvasWidth(), &Background);
+		static DU*		captureImage(const JSOURCE& Src, JRD& ResDir, SWITCHES Opts) {
+			size_t			MCUCols = Src.ScanW / (size_t(ResDir.MCUFF >> 4) * 8);				//  MCUs in each row
+			size_t			MCURows = Src.ScanH / (size_t(ResDir.MCUFF & 0x0F) * 8);				//  MCU rows in the image
+			size_t			MCUDUs = duPerMCU(ResDir);												//  DUs in an MCU
+			size_t			Bands = WorkGang::workers();											//  Bands captured concurrently
+			DU*				pDUs = nullptr;															//  Captured DUs
 
-			//  Prepare to convert the frame
-			pIFrame = pITrain->getFirstFrame();
+			if (MCUCols == 0 || MCURows == 0) return nullptr;
 
-			IH = pIFrame->getHeight();
-			IW = pIFrame->getWidth();
+			pDUs = (DU*) malloc(MCURows * MCUCols * MCUDUs * sizeof(DU));
+			if (pDUs == nullptr) return nullptr;
 
-			if (MCUFF == 0x22) {
-				OH = IH & 0xFFFFFFF0;
-				OW = IW & 0xFFFFFFF0;
+			if (Bands > MCURows) Bands = MCURows;
+			WorkGang::run(Bands, [&](size_t BX) {
+				size_t					FirstMCU = ((BX * MCURows) / Bands) * MCUCols;				//  First MCU in the band
+				size_t					LastMCU = (((BX + 1) * MCURows) / Bands) * MCUCols;			//  MCU following the band
+				EncoderPipeline			Pipe;														//  Encoder Pipeline
 
-				if (IH & 15) OH += 16;
-				if (IW & 15) OW += 16;
-			}
-			else {
-				OH = IH & 0xFFFFFFF8;
-				OW = IW & 0xFFFFFFF8;
+				conditionEncoder(Pipe, ResDir, Opts);
 
-				if (IH & 7) OH += 8;
-				if (IW & 7) OW += 8;
-			}
+				EncoderPipeline::Collecter	Source = Pipe.capture(pDUs + (FirstMCU * MCUDUs), ResDir.MCUFF);
 
-			//  Construct the target Raster Buffer
-			pNewRB = new RasterBuffer<YCbCr>(OH, OW, &Background);
+				encodeMCUs(Source, Src, ResDir, FirstMCU, LastMCU);
+				Source.signalEndOfStream();
+			});
 
-			//
-			//  Copy the source Raster Buffer to the target, converting the colour space to YCbCr.
-			//  If filling is needed then the last coloumn and last row of the source are used
-			//
+			//  Return the captured DUs
+			return pDUs;
+		}
 
-			//  Source Buffer Iterators
-			RasterBuffer<RGB>::iterator		SRIt = pIFrame->buffer().top();
-			
-			RasterBuffer<YCbCr>::iterator	LastRow = pNewRB->top();
+		//  optimiseHuffmanTrees
+		//
+		//  This static function will replace the Huffman Trees in the resource directory with trees built from the
+		//  symbol statistics of the captured DUs
+		//
+		//  PARAMETERS
+		//
+		//		JSOURCE&		-		Const reference to the source image
+		//		JRD&			-		Reference to the JPEG Resource Directory
+		//		DU*				-		Const pointer to the captured DUs
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  The symbols are counted exactly as Huffman::JPEGCollecter will emit them, DC predictors restart at each
+		//  restart interval. The luminance channel has its own trees, the two chrominance channels share trees.
+		//
 
-			//  Iterate over the target
-			for (RasterBuffer<YCbCr>::iterator TRIt = pNewRB->top(); TRIt != pNewRB->bottom(); TRIt++) {
+		static void		optimiseHuffmanTrees(const JSOURCE& Src, JRD& ResDir, const DU* pDUs) {
+			size_t			MCUs = (Src.ScanH / (size_t(ResDir.MCUFF & 0x0F) * 8)) * (Src.ScanW / (size_t(ResDir.MCUFF >> 4) * 8));	//  MCUs in the image
+			uint64_t		DCFreq[2][257] = {};													//  DC symbol frequencies (luminance, chrominance)
+			uint64_t		ACFreq[2][257] = {};													//  AC symbol frequencies (luminance, chrominance)
+			int16_t			PreviousDC[3] = {};														//  DC predictors
+			JFIF_HTAB		HT = {};																//  Huffman Table definition
 
-				if (SRIt != pIFrame->buffer().bottom()) {
-					//  Copy the row from the source extending to the right with the last pixel
-					RasterBuffer<RGB>::iterator		SCIt = pIFrame->buffer().left(SRIt);
+			for (size_t MX = 0; MX < MCUs; MX++) {
 
-					for (RasterBuffer<YCbCr>::iterator TCIt = pNewRB->left(TRIt); TCIt != pNewRB->right(TRIt); TCIt++) {
+				//  Reset the predictors at the start of each restart interval
+				if (ResDir.RestartInterval > 0 && (MX % ResDir.RestartInterval) == 0) PreviousDC[0] = PreviousDC[1] = PreviousDC[2] = 0;
 
-						if (SCIt != pIFrame->buffer().right(SRIt)) LastPixel = ColourConverter::convertToYCbCr(*SCIt);
-						*TCIt = LastPixel;
-						SCIt++;
-					}
+				for (int CX = 0; CX < 3; CX++) {
+					int				TX = (CX == 0) ? 0 : 1;										//  Table index
 
-					//  If we are before the last row of the source increment the last row iterator
-					if (!SRIt.isLast()) LastRow++;
-					SRIt++;
-				}
-				else {
-					//  Copy the last row in the target that was copied from the source
-					RasterBuffer<YCbCr>::iterator		SCIt = pNewRB->left(LastRow);
-					for (RasterBuffer<YCbCr>::iterator TCIt = pNewRB->left(TRIt); TCIt != pNewRB->right(TRIt); TCIt++) *TCIt = *SCIt;
+					for (int DUX = 0; DUX < (ResDir.HSF[CX] * ResDir.VSF[CX]); DUX++) {
+						int16_t			DeltaDC = int16_t(pDUs->DC - PreviousDC[CX]);			//  DC delta
+						int				Zeroes = 0;												//  Run of zero ACs
+
+						PreviousDC[CX] = pDUs->DC;
+						DCFreq[TX][coefficientCategory(DeltaDC)]++;
+
+						for (int ACX = 0; ACX < 63; ACX++) {
+							if (pDUs->AC[ACX] == 0) Zeroes++;
+							else {
+								while (Zeroes > 15) {
+									ACFreq[TX][0xF0]++;
+									Zeroes -= 16;
+								}
+								ACFreq[TX][(Zeroes << 4) + coefficientCategory(pDUs->AC[ACX])]++;
+								Zeroes = 0;
+							}
+						}
+
+						//  End Of Block
+						if (Zeroes > 0) ACFreq[TX][0x00]++;
+						pDUs++;
+					}
 				}
 			}
 
-			//  Append a frame to the target train containing the new raster buffer
-			pCTrain->append(new Frame<YCbCr>(pNewRB, 0, 0, nullptr));
-
-			//  Delete the intermediate train
-			delete pITrain;
+			//  Replace the DC Huffman Trees
+			delete ResDir.pHTDC[0];
+			buildOptimalTable(DCFreq[0], 0x00, HT);
+			ResDir.pHTDC[0] = new JPEGHuffmanTree(HT);
+			delete ResDir.pHTDC[1];
+			buildOptimalTable(DCFreq[1], 0x01, HT);
+			ResDir.pHTDC[2] = ResDir.pHTDC[1] = new JPEGHuffmanTree(HT);
+
+			//  Replace the AC Huffman Trees
+			delete ResDir.pHTAC[0];
+			buildOptimalTable(ACFreq[0], 0x10, HT);
+			ResDir.pHTAC[0] = new JPEGHuffmanTree(HT);
+			delete ResDir.pHTAC[1];
+			buildOptimalTable(ACFreq[1], 0x11, HT);
+			ResDir.pHTAC[2] = ResDir.pHTAC[1] = new JPEGHuffmanTree(HT);
 
-			//  Return the constructed canonical train
-			return pCTrain;
+			//  Return to caller
+			return;
 		}
 
-		//  serialiseTrain
+		//  coefficientCategory
 		//
-		//  This static function will build an in-memory JFIF/JPEG image from the passed CANONICAL Train.
+		//  This static function will return the category (bits of significance) of a coefficient
 		//
 		//  PARAMETERS
 		//
-		//		Train*			-		Pointer to the input Canonical Train
-		//		size_t&			-		Reference to the size of the in-memory image
-		//		SWITCHES		-		Options to use for storing the image
+		//		int16_t			-		Coefficient value
 		//
 		//  RETURNS
 		//
-		//		BYTE*			-		Pointer to the constructed in-memory image
+		//		int				-		Category of the coefficient (0 - 15)
 		//
 		//  NOTES
 		//
-		//		The input Train MUST be a JPEG CANONICAL Train
-		//
-
-		static BYTE* serialiseTrain(Train<YCbCr>* pTrain, size_t& ImgSize, SWITCHES Opts) {
-			BYTE*					pImage = nullptr;											//  Pointer to in-memory image
-			size_t					ImgAlc = 0;													//  Allocated size of the in-memory image
-			size_t					ImgUsed = 0;												//  Bytes used in the in-memory image
-			size_t					ImgEst = 0;													//  (Over) Estimated initial size of the image
-			JRD						ResDir = {};												//  Resource Directory
-			
-			//  Allocate memory for the image
-			ImgEst = 4096 + (256 * sizeof(YCbCr)) + ((pTrain->getCanvasHeight() + 4) * (pTrain->getCanvasWidth() + 4) * sizeof(YCbCr));
-			ImgEst += ((size_t(64) * size_t(3)) + (size_t(256) * size_t(6)));
-			ImgAlc = 0;
-			ImgUsed = 0;
-			pImage = (BYTE*) malloc(ImgEst);
-			if (pImage == nullptr) return nullptr;
-			ImgAlc = ImgEst;
-			memset(pImage, 0, ImgEst);
 
-			//  Select the resources to use for image encoding (Quantisation tables and Huffman Trees)
-			selectResources(pTrain, ResDir, Opts);
-
-			//  Append the file header to the image
-			appendFileHeader(pImage, ImgUsed);
+		static int		coefficientCategory(int16_t Coeff) {
+			uint32_t		Magnitude = (Coeff < 0) ? uint32_t(-int32_t(Coeff)) : uint32_t(Coeff);	//  Magnitude
+			int				Cat = 0;																//  Category
 
-			//  Appent the Basic (APP0) header
-			appendBasicHeader(pImage, ImgUsed);
+			Magnitude = Magnitude & 0x7FFF;
+			while (Magnitude != 0) {
+				Cat++;
+				Magnitude = Magnitude >> 1;
+			}
 
-			//  Append the Quantisation Tables used
-			appendQuantisationTables(pImage, ImgUsed, ResDir);
+			//  Return the category
+			return Cat;
+		}
 
-			//  Append Start Of Frame (SOF0)
-			appendStartOfFrame(pTrain, pImage, ImgUsed, ResDir, Opts);
+		//  buildOptimalTable
+		//
+		//  This static function will build a length limited (16 bit) optimal Huffman Table definition from symbol frequencies
+		//
+		//  PARAMETERS
+		//
+		//		uint64_t*		-		Pointer to the frequencies of the 256 symbols (257 entries, the last is reserved)
+		//		BYTE			-		Class and destination of the table
+		//		JFIF_HTAB&		-		Reference to the Huffman Table definition to be populated
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  This is the procedure of ITU-T T.81 Annex K.2. A reserved symbol with a frequency of one guarantees that no
+		//  real symbol is given the all ones code, code lengths over 16 bits are then folded back into the tree.
+		//
 
-			//  Append the Huffman Tree Table definitions that will be used
-			appendHuffmanTrees(pImage, ImgUsed, ResDir, Opts);
+		static void		buildOptimalTable(const uint64_t* pFreqIn, BYTE CandD, JFIF_HTAB& HT) {
+			uint64_t		Freq[257] = {};															//  Working frequencies
+			int				CodeSize[257] = {};														//  Code length of each symbol
+			int				Others[257] = {};														//  Next symbol in the branch
+			int				Bits[257] = {};															//  Codes of each length
+			size_t			Entries = 0;															//  Symbols in the table
+			int				C1 = 0, C2 = 0;															//  Least frequent symbols
 
-			//  Append the Start Of Scan block
-			appendStartOfScan(pImage, ImgUsed, ResDir, Opts);
+			for (int SX = 0; SX < 257; SX++) {
+				Freq[SX] = pFreqIn[SX];
+				Others[SX] = -1;
+			}
+			Freq[256] = 1;
+
+			//  Huffman's procedure, repeatedly merge the two least frequent branches
+			for (;;) {
+				C1 = C2 = -1;
+				for (int SX = 0; SX < 257; SX++) {
+					if (Freq[SX] == 0) continue;
+					if (C1 < 0 || Freq[SX] <= Freq[C1]) {
+						C2 = C1;
+						C1 = SX;
+					}
+					else if (C2 < 0 || Freq[SX] <= Freq[C2]) C2 = SX;
+				}
+				if (C2 < 0) break;
 
-			//  Append the Entropy Encoded Block (Image)
-			appendImage(pTrain, pImage, ImgUsed, ResDir, Opts);
+				Freq[C1] += Freq[C2];
+				Freq[C2] = 0;
 
-			//  Append the File Trailer block to the image
-			appendFileTrailer(pImage, ImgUsed);
+				CodeSize[C1]++;
+				while (Others[C1] >= 0) {
+					C1 = Others[C1];
+					CodeSize[C1]++;
+				}
+				Others[C1] = C2;
 
-			//  Release unused memory in the image block
-			if ((ImgAlc - ImgUsed) > 256) {
-				BYTE* pNewIBfr = (BYTE*) realloc(pImage, ImgUsed);
-				if (pNewIBfr != nullptr) {
-					pImage = pNewIBfr;
-					ImgAlc = ImgUsed;
+				CodeSize[C2]++;
+				while (Others[C2] >= 0) {
+					C2 = Others[C2];
+					CodeSize[C2]++;
 				}
 			}
 
-			//
-			//  Purge the accumulated resources from the directory
-			//
+			//  Count the codes of each length
+			for (int SX = 0; SX < 257; SX++) {
+				if (CodeSize[SX] > 0) Bits[CodeSize[SX]]++;
+			}
 
-			for (int CX = 0; CX < 3; CX++) {
+			//  Limit the code lengths to 16 bits
+			for (int LX = 256; LX > 16; LX--) {
+				while (Bits[LX] > 0) {
+					int				JX = LX - 2;													//  Shorter length with a prefix to split
 
-				if (ResDir.pQ[CX] != nullptr) {
-					 delete ResDir.pQ[CX];
-					if (ResDir.pQ[CX + 1] == ResDir.pQ[CX]) ResDir.pQ[CX + 1] = nullptr;
-					ResDir.pQ[CX] = nullptr;
+					while (Bits[JX] == 0) JX--;
+					Bits[LX] -= 2;
+					Bits[LX - 1]++;
+					Bits[JX + 1] += 2;
+					Bits[JX]--;
 				}
+			}
 
-				if (ResDir.pHTDC[CX] != nullptr) {
-					delete ResDir.pHTDC[CX];
-					if (ResDir.pHTDC[CX + 1] == ResDir.pHTDC[CX]) ResDir.pHTDC[CX + 1] = nullptr;
-					ResDir.pHTDC[CX] = nullptr;
+			//  Remove the reserved symbol (the longest code)
+			for (int LX = 16; LX > 0; LX--) {
+				if (Bits[LX] > 0) {
+					Bits[LX]--;
+					break;
 				}
+			}
 
-				if (ResDir.pHTAC[CX] != nullptr) {
-					delete ResDir.pHTAC[CX];
-					if (ResDir.pHTAC[CX + 1] == ResDir.pHTAC[CX]) ResDir.pHTAC[CX + 1] = nullptr;
-					ResDir.pHTAC[CX] = nullptr;
+			//  Build the table definition, symbols in order of code length
+			memset(&HT, 0, sizeof(JFIF_HTAB));
+			HT.Signature = JFIF_BLKID_SIG;
+			HT.ID = JFIF_BLKID_DHT;
+			HT.CandD = CandD;
+			for (int LX = 1; LX <= 16; LX++) HT.HTL[LX - 1] = BYTE(Bits[LX]);
+			for (int LX = 1; LX <= 256; LX++) {
+				for (int SX = 0; SX < 256; SX++) {
+					if (CodeSize[SX] == LX) HT.HTEntry[Entries++] = BYTE(SX);
 				}
 			}
+			SetSizeBE(HT.Length, uint16_t(2 + 1 + 16 + Entries));
 
-			//  Return the in-memory image to the caller
-			ImgSize = ImgUsed;
-			return pImage;
+			//  Return to caller
+			return;
 		}
 
-		//  appendImage
+		//  conditionEncoder
 		//
-		//  This static function will append the Entropy Encoded Block (Image)
+		//  This static function will setup an encoder pipeline for the image
 		//
 		//  PARAMETERS
 		//
-		//		Train*			-		Pointer to the train being stored
-		//		Byte*			-		Pointer to the in-memory image
-		//		size_t&			-		Reference to the size used of the in-memory image
-		//		JRD&			-		Reference to the JPEG Resource Directory
-		//		SWITCHES		-		Options array
+		//		EncoderPipeline&	-		Reference to the pipeline to be conditioned
+		//		JRD&				-		Reference to the JPEG Resource Directory
+		//		SWITCHES			-		Options array
 		//
 		//  RETURNS
 		//
 		//  NOTES
 		//
-		//
 
-		static void		appendImage(Train<YCbCr>* pTrain, BYTE* pImage, size_t& ImgUsed, JRD& ResDir, SWITCHES Opts) {
-			(void)Opts;
-			StuffedStream			bsOut(2 * pTrain->getCanvasWidth() * pTrain->getCanvasHeight(), pTrain->getCanvasWidth() * pTrain->getCanvasHeight());
-			EncoderPipeline			Pipe;															//  Encoder Pipeline
-			Huffman					EEC;															//  Entropy Encoder
-			BYTE*					pEncImg = nullptr;												//  Pointer to the encoded image buffer
-			size_t					EISize = 0;														//  Encoded image size
+		static void		conditionEncoder(EncoderPipeline& Pipe, JRD& ResDir, SWITCHES Opts) {
 
 			//  Prepare the pipeline for encoding the frame
 			Pipe.setPrecision(8);																	//  Precision (channel width) always 8 bits
 			Pipe.setMCUFF(ResDir.MCUFF);															//  Set the MCU Form factor
 
+			//  Select the forward DCT engine
+			if (Opts & JFIF_STORE_OPT_FDCT_REFERENCE) Pipe.setFDCTEngine(EncoderPipeline::FDCT_ENGINE_REFERENCE);
+			else if (Opts & JFIF_STORE_OPT_FDCT_FLOAT) Pipe.setFDCTEngine(EncoderPipeline::FDCT_ENGINE_FLOAT);
+			else Pipe.setFDCTEngine(EncoderPipeline::FDCT_ENGINE_INTEGER);
+
 			//  Set the channel specific characteristics
 			for (int CX = 0; CX < 3; CX++) {
 				//  Set the Horizontal & Vertical sampling factors
@@ -4568,40 +7783,74 @@ namespace xymorg {
 				Pipe.setACEncoder(CX, ResDir.pHTAC[CX]);
 			}
 
-			//
-			//  Arrange the plumbing for the input and output:
-			//
-			//		RasterBuffer  ==> Pipeline::Collecter ==> Pipeline ==> Huffman::Collecter ==> StuffedStream
-			//
+			//  Return to caller
+			return;
+		}
 
-			Huffman::JPEGCollecter		Sink = EEC.encodeJPEG(bsOut);
-			EncoderPipeline::Collecter	Source = Pipe.encode(&Sink, ResDir.MCUFF);
+		//  appendRestartInterval
+		//
+		//  This static function will append the Define Restart Interval (DRI) block to the image
+		//
+		//  PARAMETERS
+		//
+		//		JSOURCE&		-		Reference to the source image
+		//		Byte*			-		Pointer to the in-memory image
+		//		size_t&			-		Reference to the size used of the in-memory image
+		//		JRD&			-		Reference to the JPEG Resource Directory
+		//		SWITCHES		-		Options array
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  The interval is a whole number of MCU rows (options bits 8 - 15), reduced if necessary to fit the 16 bit
+		//  interval field.
+		//
 
-			//
-			//  Iterate over the raster buffer in MCU sequence feeding the pixels to the pipeline collecter
-			//
+		static void		appendRestartInterval(JSOURCE& Src, BYTE* pImage, size_t& ImgUsed, JRD& ResDir, SWITCHES Opts) {
+			JFIF_DRI_BLOCK*		pDRI = (JFIF_DRI_BLOCK*) (pImage + ImgUsed);						//  Pointer to the DRI structure
 
-			for (RasterBuffer<YCbCr>::iterator It = pTrain->getFirstFrame()->buffer().firstMCU(ResDir.MCUFF); It != pTrain->getFirstFrame()->buffer().lastMCU(ResDir.MCUFF); It++) {
-				Source.next(*It);
-			}
+			ResDir.RestartInterval = restartInterval(Src, ResDir, Opts);
 
-			//  Signal end of the pixel stream to the pipeline
-			Source.signalEndOfStream();
+			//  Set the ID and length
+			pDRI->Signature = JFIF_BLKID_SIG;
+			pDRI->ID = JFIF_BLKID_DRI;
+			SetSizeBE(pDRI->Length, uint16_t(4));
+			SetSizeBE(pDRI->Interval, uint16_t(ResDir.RestartInterval));
 
-			//  Acquire the stuffed stream buffer
-			pEncImg = bsOut.acquireBuffer(EISize);
+			//  Update the size of image used
+			ImgUsed += sizeof(JFIF_DRI_BLOCK);
 
-			//  Copy the encoded image into the image
-			memcpy(pImage + ImgUsed, pEncImg, EISize);
+			//  Return to caller
+			return;
+		}
 
-			//  Update the image size
-			ImgUsed += EISize;
+		//  restartInterval
+		//
+		//  This static function will determine the restart interval (in MCUs) to use for the image
+		//
+		//  PARAMETERS
+		//
+		//		JSOURCE&		-		Const reference to the source image
+		//		JRD&			-		Const reference to the JPEG Resource Directory
+		//		SWITCHES		-		Options array
+		//
+		//  RETURNS
+		//
+		//		size_t			-		Number of MCUs in each restart interval
+		//
+		//  NOTES
+		//
 
-			//  Free the encoding buffer
-			free(pEncImg);
+		static size_t	restartInterval(const JSOURCE& Src, const JRD& ResDir, SWITCHES Opts) {
+			size_t				MCUCols = Src.ScanW / (size_t(ResDir.MCUFF >> 4) * 8);				//  MCUs in each row
+			size_t				Rows = (Opts >> JFIF_STORE_RESTART_ROWS_SHIFT) & 0xFF;				//  MCU rows per interval
 
-			//  Return to caller
-			return;
+			if (Rows == 0) Rows = 1;
+			while (Rows > 1 && (Rows * MCUCols) > 0xFFFF) Rows--;
+
+			//  Return the interval
+			return Rows * MCUCols;
 		}
 
 		//  appendStartOfScan
@@ -4833,7 +8082,7 @@ namespace xymorg {
 		//
 		//  PARAMETERS
 		//
-		//		Train*			-		Pointer to the train being stored
+		//		JSOURCE&		-		Reference to the source image
 		//		Byte*			-		Pointer to the in-memory image
 		//		size_t&			-		Reference to the size used of the in-memory image
 		//		JRD&			-		Reference to the JPEG Resource Directory
@@ -4847,7 +8096,7 @@ namespace xymorg {
 		//
 		//
 
-		static void		appendStartOfFrame(Train<YCbCr>* pTrain, BYTE* pImage, size_t& ImgUsed, JRD& ResDir, SWITCHES Opts) {
+		static void		appendStartOfFrame(JSOURCE& Src, BYTE* pImage, size_t& ImgUsed, JRD& ResDir, SWITCHES Opts) {
 			(void)Opts;
 			JFIF_FRAME_HEADER*		pFH = (JFIF_FRAME_HEADER*) (pImage + ImgUsed);									//  Pointer to the SOF0 block
 			JFIF_FRAME_COMPONENT*	pFC = (JFIF_FRAME_COMPONENT*) (pImage + ImgUsed + 10);							//  Pointer to the first component in the frame
@@ -4859,8 +8108,8 @@ namespace xymorg {
 			pFH->Precision = 8;
 
 			//  Set the height and width of the image
-			SetSizeBE(pFH->HLines, uint16_t(pTrain->getCanvasHeight()));
-			SetSizeBE(pFH->VLines, uint16_t(pTrain->getCanvasWidth()));
+			SetSizeBE(pFH->HLines, uint16_t(Src.Height));
+			SetSizeBE(pFH->VLines, uint16_t(Src.Width));
 
 			//  Set the number of components (always 3)
 			pFH->Components = 3;
@@ -5083,7 +8332,7 @@ namespace xymorg {
 		//
 		//  PARAMETERS
 		//
-		//		Train*			-		Pointer to the input Canonical Train
+		//		JSOURCE&		-		Reference to the source image
 		//		JRD&			-		Reference to the resource directory structure
 		//		SWITCHES		-		Options to use for storing the image
 		//
@@ -5092,8 +8341,8 @@ namespace xymorg {
 		//  NOTES
 		//
 		
-		static void		selectResources(Train<YCbCr>* pTrain, JRD& ResDir, SWITCHES Opts) {
-			(void)pTrain;
+		static void		selectResources(JSOURCE& Src, JRD& ResDir, SWITCHES Opts) {
+			(void)Src;
 			//  Default quantisation table for luminance channel (8 bit precision)
 			JFIF_QV8_ARRAY		DefY8 = { 0, {16,11,10,16,24,40,51,61,
 											12,12,14,19,26,58,60,55,
@@ -5226,12 +8475,22 @@ namespace xymorg {
 			if (Opts & JFIF_STORE_OPT_HIFI) ResDir.MCUFF = 0x11;
 			else ResDir.MCUFF = 0x22;
 
-			//  Set the default luminance quantization table
-			ResDir.pQ[0] = new JPEGQuantizer((BYTE*) &AltY8);
-			ResDir.QUse[0] = 0;
+			//  Set the quantization tables for the requested quality, these are shared with other images
+			if (((Opts >> JFIF_STORE_QUALITY_SHIFT) & 0xFF) > 0) {
+				int		Quality = int((Opts >> JFIF_STORE_QUALITY_SHIFT) & 0xFF);						//  Requested quality
+
+				ResDir.pQ[0] = qualityQuantizer(Quality, 0, DefY8);
+				ResDir.pQ[2] = ResDir.pQ[1] = qualityQuantizer(Quality, 1, DefC8);
+				ResDir.SharedQ = true;
+			}
+			else {
+				//  Set the default luminance quantization table
+				ResDir.pQ[0] = new JPEGQuantizer((BYTE*) &AltY8);
 
-			//  Set the default chrominance quantization table for both Cb and Cr channels
-			ResDir.pQ[2] = ResDir.pQ[1] = new JPEGQuantizer((BYTE*) &AltC8);
+				//  Set the default chrominance quantization table for both Cb and Cr channels
+				ResDir.pQ[2] = ResDir.pQ[1] = new JPEGQuantizer((BYTE*) &AltC8);
+			}
+			ResDir.QUse[0] = 0;
 			ResDir.QUse[2] = ResDir.QUse[1] = 1;
 
 			//  Set the Default DC Huffman trees, luminance followed by chrominace
@@ -5250,6 +8509,72 @@ namespace xymorg {
 			return;
 		}
 
+		//  qualityQuantizer
+		//
+		//  This static function will return the quantizer for a base quantization table scaled to a quality
+		//
+		//  PARAMETERS
+		//
+		//		int					-		Quality (1 - 100)
+		//		int					-		Table (0 - luminance, 1 - chrominance)
+		//		JFIF_QV8_ARRAY&		-		Const reference to the base table (natural order)
+		//
+		//  RETURNS
+		//
+		//		JPEGQuantizer*		-		Pointer to the (shared) quantizer
+		//
+		//  NOTES
+		//
+		//  The table values are scaled as the IJG library does, 5000 / Quality percent below 50 and 200 - (2 x Quality)
+		//  percent above, limited to 1 - 255. Quantizers (with their reciprocals) are built once for each quality and
+		//  table and are then shared by all images for the life of the process, they must not be deleted.
+		//
+
+		static JPEGQuantizer*	qualityQuantizer(int Quality, int Table, const JFIF_QV8_ARRAY& Base) {
+			static std::atomic<JPEGQuantizer*>	Cache[2][100];										//  Quantizers by table and quality
+			const int			ZZ[64] = { 0, 1, 8, 16, 9, 2, 3, 10,
+											17, 24, 32, 25, 18, 11, 4, 5,
+											12, 19, 26, 33, 40, 48, 41, 34,
+											27, 20, 13, 6, 7, 14, 21, 28,
+											35, 42, 49, 56, 57, 50, 43, 36,
+											29, 22, 15, 23, 30, 37, 44, 51,
+											58, 59, 52, 45, 38, 31, 39, 46,
+											53, 60, 61, 54, 47, 55, 62, 63 };						//  Zig-Zag position to natural position
+			JFIF_QV8_ARRAY		Scaled = {};														//  Scaled table (zig-zag order)
+			JPEGQuantizer*		pQ = nullptr;														//  Quantizer
+			JPEGQuantizer*		pCached = nullptr;													//  Cached quantizer
+			int					Scale = 0;															//  Scaling percentage
+
+			if (Quality < 1) Quality = 1;
+			if (Quality > 100) Quality = 100;
+
+			//  Return the cached quantizer if already built
+			pCached = Cache[Table][Quality - 1].load();
+			if (pCached != nullptr) return pCached;
+
+			//  Scale the base table
+			if (Quality < 50) Scale = 5000 / Quality;
+			else Scale = 200 - (2 * Quality);
+
+			for (int zIndex = 0; zIndex < 64; zIndex++) {
+				int		Value = ((int(Base.QV[ZZ[zIndex]]) * Scale) + 50) / 100;				//  Scaled value
+
+				if (Value < 1) Value = 1;
+				if (Value > 255) Value = 255;
+				Scaled.QV[zIndex] = BYTE(Value);
+			}
+			pQ = new JPEGQuantizer((BYTE*) &Scaled);
+
+			//  Publish the quantizer, if another thread got there first then use that one
+			if (!Cache[Table][Quality - 1].compare_exchange_strong(pCached, pQ)) {
+				delete pQ;
+				pQ = pCached;
+			}
+
+			//  Return the quantizer
+			return pQ;
+		}
+
 		//  mapImage
 		//
 		//  This static function will build the map of the on-disk image
@@ -5269,7 +8594,6 @@ namespace xymorg {
 			size_t			Offset = 0;														//  Offset in the in-memory image
 			bool			EndOfImage = false;												//  End Of Image
 			size_t			EEBSize = 0;													//  Size of entropy encoded block
-			BYTE*			pSOB = nullptr;													//  Pointer to start of a block
 
 			//  Initialise the block array
 			Map.NBA = 256;
@@ -5312,6 +8636,19 @@ namespace xymorg {
 
 			while ((!EndOfImage) && Offset < Map.ImageSize) {
 
+				//  Check that we have enough space in the map for at least 5 blocks - if not then expand the map
+				if (Map.NumBlocks >= (Map.NBA - 5)) {
+					Map.NBA += 256;
+					ODIBlock*	pTemp = (ODIBlock*) realloc(Map.Blocks, Map.NBA * sizeof(ODIBlock));
+					if (pTemp == nullptr) {
+						std::cerr << "ERROR: Failed to reallocate the JFIF Map to hold: " << Map.NBA << " blocks." << std::endl;
+						free(Map.Blocks);
+						Map.NBA = Map.NumBlocks = 0;
+						return false;
+					}
+					else Map.Blocks = pTemp;
+				}
+
 				//  Address the next block
 				JFIF_DATA_BLOCK*	pBlock = (JFIF_DATA_BLOCK*)	(Map.Image + Offset);
 				if (pBlock->Signature != JFIF_BLKID_SIG) {
@@ -5321,6 +8658,16 @@ namespace xymorg {
 					return false;
 				}
 
+				//  The marker (and the length field of blocks that have one) must be within the image
+				if ((Offset + 2) > Map.ImageSize ||
+					(pBlock->ID != JFIF_BLKID_EOI && (pBlock->ID < JFIF_BLKID_RST0 || pBlock->ID > JFIF_BLKID_RST7) &&
+					 ((Offset + 4) > Map.ImageSize || GetSizeBE(pBlock->Length) < 2))) {
+					std::cerr << "ERROR: Block: " << Map.NumBlocks + 1 << " at Offset: +" << Offset << " is truncated or has an invalid length." << std::endl;
+					free(Map.Blocks);
+					Map.NBA = Map.NumBlocks = 0;
+					return false;
+				}
+
 				//  Switch according to the type of the block encountered
 				switch (pBlock->ID) {
 
@@ -5410,12 +8757,12 @@ namespace xymorg {
 					//  having no block descriptor.
 					//
 
-					EEBSize = 0;
 					//  Scan the block to determine the length of the EEB
-					pSOB = Map.Image + Offset;
-					while (*pSOB != JFIF_BLKID_SIG || *(pSOB + 1) == JFIF_BLKID_STUFF) {
-						EEBSize++;
-						pSOB++;
+					if (!sizeEEB(Map, Offset, EEBSize)) {
+						std::cerr << "ERROR: The Entropy Encoded Block at Offset: +" << Offset << " is not terminated by a marker before the end of the image." << std::endl;
+						free(Map.Blocks);
+						Map.NBA = Map.NumBlocks = 0;
+						return false;
 					}
 
 					Map.Blocks[Map.NumBlocks].BlockType = JFIF_BLOCK_EEB;
@@ -5426,6 +8773,16 @@ namespace xymorg {
 					Offset += EEBSize;
 					break;
 
+				case JFIF_BLKID_DRI:
+					//  Define Restart Interval block
+					Map.Blocks[Map.NumBlocks].BlockType = JFIF_BLOCK_DRI;
+					Map.Blocks[Map.NumBlocks].Block = (Map.Image + Offset);
+					Map.Blocks[Map.NumBlocks].BlockSize = (GetSizeBE(pBlock->Length) + 2);
+					Map.NumBlocks++;
+
+					Offset += (GetSizeBE(pBlock->Length) + 2);
+					break;
+
 				case JFIF_BLKID_EOI:
 					//  End Of Image block
 					Map.Blocks[Map.NumBlocks].BlockType = JFIF_BLOCK_FT;
@@ -5445,25 +8802,25 @@ namespace xymorg {
 				case JFIF_BLKID_RST5:
 				case JFIF_BLKID_RST6:
 				case JFIF_BLKID_RST7:
-					//  Restart Scan blocks
+					//  Restart Scan blocks - the marker has no length field
 					Map.Blocks[Map.NumBlocks].BlockType = JFIF_BLOCK_RST;
 					Map.Blocks[Map.NumBlocks].Block = (Map.Image + Offset);
-					Map.Blocks[Map.NumBlocks].BlockSize = (GetSizeBE(pBlock->Length) + 2);
+					Map.Blocks[Map.NumBlocks].BlockSize = 2;
 					Map.NumBlocks++;
 
-					Offset += (GetSizeBE(pBlock->Length) + 2);
+					Offset += 2;
 
 					//
 					//  Restart block is ALWAYS immediately followed by the Entropy Encoded Block (EEB)
 					//  having no block descriptor.
 					//
 
-					EEBSize = 0;
 					//  Scan the block to determine the length of the EEB
-					pSOB = Map.Image + Offset;
-					while (*pSOB != JFIF_BLKID_SIG || *(pSOB + 1) == JFIF_BLKID_STUFF) {
-						EEBSize++;
-						pSOB++;
+					if (!sizeEEB(Map, Offset, EEBSize)) {
+						std::cerr << "ERROR: The Entropy Encoded Block at Offset: +" << Offset << " is not terminated by a marker before the end of the image." << std::endl;
+						free(Map.Blocks);
+						Map.NBA = Map.NumBlocks = 0;
+						return false;
 					}
 
 					Map.Blocks[Map.NumBlocks].BlockType = JFIF_BLOCK_EEB;
@@ -5503,12 +8860,52 @@ namespace xymorg {
 					Map.NBA = Map.NumBlocks = 0;
 					return false;
 				}
+
+				//  The block must not extend beyond the end of the image
+				if (Offset > Map.ImageSize) {
+					std::cerr << "ERROR: Block: " << Map.NumBlocks << " extends beyond the end of the image." << std::endl;
+					free(Map.Blocks);
+					Map.NBA = Map.NumBlocks = 0;
+					return false;
+				}
 			}
 
 			//  Return successful mapping
 			return true;
 		}
 
+		//  sizeEEB
+		//
+		//  This static function will determine the size of an Entropy Encoded Block (EEB)
+		//
+		//  PARAMETERS
+		//
+		//		ODIMap&			-		Const reference to the ODIMap of the image
+		//		size_t			-		Offset of the start of the EEB
+		//		size_t&			-		Reference to the variable to receive the size of the EEB
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the EEB is terminated by a marker within the image, otherwise false
+		//
+		//  NOTES
+		//
+		//  The EEB has no block descriptor, it extends up to the next marker that is not a stuffed 0xFF byte.
+		//
+
+		static bool		sizeEEB(const ODIMap& Map, size_t Offset, size_t& EEBSize) {
+			const BYTE*		pSOB = Map.Image + Offset;											//  Pointer to start of the block
+
+			EEBSize = 0;
+			while ((Offset + EEBSize + 1) < Map.ImageSize) {
+				if (pSOB[EEBSize] == JFIF_BLKID_SIG && pSOB[EEBSize + 1] != JFIF_BLKID_STUFF) return true;
+				EEBSize++;
+			}
+
+			//  No marker was found
+			return false;
+		}
+
 		//  Analysis Documentation Functions
 
 		//  showFileHeader
@@ -5980,6 +9377,41 @@ namespace xymorg {
 			return;
 		}
 
+		//  showDRI
+		//
+		//  This static function will document a Define Restart Interval block
+		//
+		//  PARAMETERS
+		//
+		//		size_t			-		Block number
+		//		size_t			-		Offset in the file
+		//		ODIMap&			-		Reference to the JFIF On-Disk-Image map
+		//		std::ostream&	-		Reference to the output stream
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+
+		static void		showDRI(size_t BlockNo, size_t Offset, ODIMap& Map, std::ostream& OS) {
+			JFIF_DRI_BLOCK*		pDRI = (JFIF_DRI_BLOCK*) (Map.Image + Offset);
+
+			OS << std::endl;
+			OS << "JFIF/JPEG DEFINE RESTART INTERVAL - Block: " << BlockNo + 1 << ", Offset: +" << Offset << ", Size: " << Map.Blocks[BlockNo].BlockSize << "." << std::endl;
+
+			//  Dump the memory image
+			OS << std::endl;
+			MemoryDumper::dumpMemory(Map.Image + Offset, Map.Blocks[BlockNo].BlockSize, "DRI", OS);
+			OS << std::endl;
+
+			//  Show details
+			OS << std::endl;
+			OS << " Restart Interval (MCUs):   " << GetSizeBE(pDRI->Interval) << "." << std::endl;
+
+			//  Return to caller
+			return;
+		}
+
 		//  showFT
 		//
 		//  This static function will document a File Trailer block
@@ -6026,6 +9458,21 @@ namespace xymorg {
 
 		//  Options for storing images
 		static const SWITCHES	JPEG_STORE_OPT_HIFI = 1;										//  High Fidelity Image 1x1 sampling
+		static const SWITCHES	JPEG_STORE_OPT_FDCT_FLOAT = 2;									//  Use the floating-point FDCT engine
+		static const SWITCHES	JPEG_STORE_OPT_FDCT_REFERENCE = 4;								//  Use the reference (direct) FDCT
+		static const SWITCHES	JPEG_STORE_OPT_RESTART = 8;										//  Emit restart intervals (strips encoded concurrently)
+		static const SWITCHES	JPEG_STORE_OPT_OPTIMISE = 16;									//  Two pass encoding with optimised Huffman tables
+		static const int		JPEG_STORE_RESTART_ROWS_SHIFT = 8;								//  Options bits 8-15 hold MCU rows per interval (0 = 1)
+		static const int		JPEG_STORE_QUALITY_SHIFT = 16;									//  Options bits 16-23 hold the quality 1-100 (0 = default tables)
+
+		//  Options for loading images
+		static const SWITCHES	JPEG_LOAD_OPT_IDCT_FLOAT = 1;									//  Use the floating-point IDCT engine
+		static const SWITCHES	JPEG_LOAD_OPT_IDCT_REFERENCE = 2;								//  Use the reference (direct) IDCT
+		static const SWITCHES	JPEG_LOAD_OPT_FANCY_UPSAMPLING = 4;								//  Triangular (smooth) chroma upsampling
+		static const SWITCHES	JPEG_LOAD_OPT_SCALE_1_2 = 8;									//  Decode at 1/2 scale (4x4 IDCT)
+		static const SWITCHES	JPEG_LOAD_OPT_SCALE_1_4 = 16;									//  Decode at 1/4 scale (2x2 IDCT)
+		static const SWITCHES	JPEG_LOAD_OPT_SCALE_1_8 = 24;									//  Decode at 1/8 scale (DC only)
+		static const SWITCHES	JPEG_LOAD_OPT_PROGRESSIVE_PREVIEW = 32;							//  Stop a progressive frame after the DC scan(s)
 
 		//  Prevent instantiation
 		JPEG() = delete;
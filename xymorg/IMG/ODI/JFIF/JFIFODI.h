@@ -70,6 +70,7 @@ constexpr auto	JFIF_BLKID_SOF15		= 0xCF;								//  Start of Frame - differentia
 constexpr auto	JFIF_BLKID_DHT			= 0xC4;								//  Define Huffman table
 constexpr auto	JFIF_BLKID_DAC			= 0xCC;								//  Define arithmetic coding
 constexpr auto	JFIF_BLKID_DNL			= 0xDC;								//  Define number of lines
+constexpr auto	JFIF_BLKID_DRI			= 0xDD;								//  Define restart interval
 constexpr auto	JFIF_BLKID_SOS			= 0xDA;								//  Start of scan segment
 constexpr auto	JFIF_BLKID_STUFF		= 0x00;								//  Stuffing block
 constexpr auto	JFIF_BLKID_RST0			= 0xD0;								//  Restart (0) block
@@ -247,6 +248,15 @@ typedef struct JFIF_SCAN_HEADER2
 #define			GetABSelLo(x)				(x & 0x0F)						//  Extract the low approximation bit selector
 #define			GetABSelHi(x)				((x & 0xF0) >> 4)				//  Extract the high approximation bit selector
 
+//  JFIF Define Restart Interval
+typedef struct JFIF_DRI_BLOCK
+{
+	BYTE		Signature;													//  Block marker JFIF_BLKID_SIG
+	BYTE		ID;															//  Block identifier JFIF_BLKID_DRI
+	BYTE		Length[2];													//  Length (always 4)
+	BYTE		Interval[2];												//  Restart interval (MCUs), 0 disables restarts
+} JFIF_DRI_BLOCK;
+
 //
 //  JFIF block types
 //
@@ -260,6 +270,7 @@ constexpr auto	JFIF_BLOCK_SOFX = 'G';										//  Start Of Frame (x) block
 constexpr auto	JFIF_BLOCK_SOS = 'S';										//  Start Of Scan block (JFIF_SCAN_HEADER1)
 constexpr auto	JFIF_BLOCK_EEB = 'I';										//  Image Data (Entropy Encoded Block)
 constexpr auto	JFIF_BLOCK_RST = 'R';										//  Restart scan block(s)
+constexpr auto	JFIF_BLOCK_DRI = 'D';										//  Define Restart Interval block (JFIF_DRI_BLOCK)
 constexpr auto	JFIF_BLOCK_RES = 'X';										//  Application reserved block(s)
 constexpr auto	JFIF_BLOCK_FT = 'T';										//  File Trailer (JFIF_FILE_TRAILER)
 
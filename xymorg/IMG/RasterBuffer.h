@@ -25,6 +25,7 @@
 //*	1.0.0 - 04/08/2018   -  Initial version																			*
 //*	1.1.0 - 23/11/2022   -  Added difference() map generation function												*
 //*	1.1.1 - 08/12/2024   -  Winter Cleanup																			*
+//*	1.1.2 - 16/10/2026   -  Row span comparison for matches()														*
 //*																													*
 //*******************************************************************************************************************
 
@@ -41,6 +42,17 @@
 #include	"CIBase2D.h"																			//  2D Iterator Base Class
 #include	"ColourTable.h"																			//  Colour Table
 
+//
+//  SIMD span comparison
+//
+//  XY_RB_SSE2 is defined when the build target guarantees SSE2 (all x86-64 targets).
+//
+
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define		XY_RB_SSE2
+#include	<emmintrin.h>																			//  SSE2 intrinsics
+#endif
+
 //*******************************************************************************************************************
 //*                                                                                                                 *
 //*   RasterBuffer Template Class		                                                                            *
@@ -528,6 +540,68 @@ namespace xymorg {
 			return &Buffer[(R * Width) + C];
 		}
 
+		//  readTile
+		//
+		//  Copies a rectangular tile of pixels out of the buffer into a contiguous (row major) block
+		//
+		//  PARAMETERS
+		//
+		//		size_t			-		Row index of the top left pixel of the tile
+		//		size_t			-		Column index of the top left pixel of the tile
+		//		size_t			-		Height of the tile (rows)
+		//		size_t			-		Width of the tile (columns)
+		//		T*				-		Pointer to the block to receive the tile (Height * Width pixels)
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the tile was copied, false if it does not lie within the buffer
+		//
+		//  NOTES
+		//
+
+		bool	readTile(const size_t R, const size_t C, const size_t TH, const size_t TW, T* pTile) const {
+			//  If the RasterBuffer is invalid or the tile is outside the bounds then nothing is copied
+			if (Height == 0 || Width == 0 || Buffer == NULL || pTile == NULL) return false;
+			if ((R + TH) > Height || (C + TW) > Width) return false;
+
+			//  Copy each row of the tile
+			for (size_t RX = 0; RX < TH; RX++) memcpy(pTile + (RX * TW), &Buffer[((R + RX) * Width) + C], TW * sizeof(T));
+
+			//  Return to caller
+			return true;
+		}
+
+		//  writeTile
+		//
+		//  Copies a contiguous (row major) block of pixels into a rectangular tile of the buffer
+		//
+		//  PARAMETERS
+		//
+		//		size_t			-		Row index of the top left pixel of the tile
+		//		size_t			-		Column index of the top left pixel of the tile
+		//		size_t			-		Height of the tile (rows)
+		//		size_t			-		Width of the tile (columns)
+		//		T*				-		Const pointer to the block holding the tile (Height * Width pixels)
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the tile was copied, false if it does not lie within the buffer
+		//
+		//  NOTES
+		//
+
+		bool	writeTile(const size_t R, const size_t C, const size_t TH, const size_t TW, const T* pTile) {
+			//  If the RasterBuffer is invalid or the tile is outside the bounds then nothing is copied
+			if (Height == 0 || Width == 0 || Buffer == NULL || pTile == NULL) return false;
+			if ((R + TH) > Height || (C + TW) > Width) return false;
+
+			//  Copy each row of the tile
+			for (size_t RX = 0; RX < TH; RX++) memcpy(&Buffer[((R + RX) * Width) + C], pTile + (RX * TW), TW * sizeof(T));
+
+			//  Return to caller
+			return true;
+		}
+
 		//  setPixel
 		//
 		//  Sets the value of the given pixel to the passed colour.
@@ -1533,7 +1607,7 @@ namespace xymorg {
 		//
 
 		bool	matches(RasterBuffer<T>& Comp, BoundingBox& Diff) {
-			bool			DiffDetected = false;											//  Difference detected
+			size_t			MX = 0;															//  Mismatch position
 
 			//  Clear the bounding box
 			Diff.Top = 0;
@@ -1548,68 +1622,36 @@ namespace xymorg {
 				return false;
 			}
 
-			//  Make passes from each edge of the image to determine the outline extents of the differences
-			//  Top
-			DiffDetected = false;
-			Diff.Top = Height;
-			for (iterator RIt = top(); RIt != bottom(); RIt++) {
-				for (iterator CIt = left(RIt); CIt != right(RIt); CIt++) {
-					if (*CIt != *(Comp.getPixel(RIt.getIndex(), CIt.getIndex()))) {
-						DiffDetected = true;
-						break;
-					}
-				}
-				if (DiffDetected) {
-					Diff.Top = RIt.getIndex();
-					break;
-				}
+			//  Top - the first row that holds a difference, it also sets the initial left and right extents
+			for (Diff.Top = 0; Diff.Top < Height; Diff.Top++) {
+				MX = firstMismatch(Buffer + (Diff.Top * Width), Comp.Buffer + (Diff.Top * Width), Width);
+				if (MX < Width) break;
 			}
 
 			//  NO Difference Detected
 			if (Diff.Top == Height) return true;
 
-			//  Bottom
-			DiffDetected = false;
-			for (iterator RIt = bottom(); RIt != top(); RIt--) {
-				for (iterator CIt = left(RIt); CIt != right(RIt); CIt++) {
-					if (*CIt != *(Comp.getPixel(RIt.getIndex(), CIt.getIndex()))) {
-						DiffDetected = true;
-						break;
-					}
-				}
-				if (DiffDetected) {
-					Diff.Bottom = RIt.getIndex();
-					break;
-				}
-			}
+			Diff.Left = MX;
+			Diff.Right = lastMismatch(Buffer + (Diff.Top * Width), Comp.Buffer + (Diff.Top * Width), Width) - 1;
 
-			//  Left
-			DiffDetected = false;
-			for (iterator CIt = left(); CIt != right(); CIt++) {
-				for (iterator RIt = top(CIt); RIt != bottom(CIt); RIt++) {
-					if (*RIt != *(Comp.getPixel(RIt.getIndex(), CIt.getIndex()))) {
-						DiffDetected = true;
-						break;
-					}
-				}
-				if (DiffDetected) {
-					Diff.Left = CIt.getIndex();
-					break;
-				}
+			//  Bottom - the last row that holds a difference
+			for (Diff.Bottom = Height - 1; Diff.Bottom > Diff.Top; Diff.Bottom--) {
+				if (firstMismatch(Buffer + (Diff.Bottom * Width), Comp.Buffer + (Diff.Bottom * Width), Width) < Width) break;
 			}
 
-			//  Right
-			DiffDetected = false;
-			for (iterator CIt = right(); CIt != left(); CIt--) {
-				for (iterator RIt = top(CIt); RIt != bottom(CIt); RIt++) {
-					if (*RIt != *(Comp.getPixel(RIt.getIndex(), CIt.getIndex()))) {
-						DiffDetected = true;
-						break;
-					}
+			//  Left and Right - each row only needs to be compared outside the extents found so far
+			for (size_t Row = Diff.Top + 1; Row <= Diff.Bottom; Row++) {
+				const T*	pRow = Buffer + (Row * Width);
+				const T*	pCompRow = Comp.Buffer + (Row * Width);
+
+				if (Diff.Left > 0) {
+					MX = firstMismatch(pRow, pCompRow, Diff.Left);
+					if (MX < Diff.Left) Diff.Left = MX;
 				}
-				if (DiffDetected) {
-					Diff.Right = CIt.getIndex();
-					break;
+
+				if (Diff.Right < Width - 1) {
+					MX = lastMismatch(pRow + (Diff.Right + 1), pCompRow + (Diff.Right + 1), Width - (Diff.Right + 1));
+					if (MX > 0) Diff.Right += MX;
 				}
 			}
 
@@ -1617,6 +1659,90 @@ namespace xymorg {
 			return false;
 		}
 
+		//  firstMismatch
+		//
+		//  This static function will find the first pixel that differs between two spans of pixels
+		//
+		//  PARAMETERS
+		//
+		//		T*							-		Const pointer to the first span
+		//		T*							-		Const pointer to the second span
+		//		size_t						-		Number of pixels in each span
+		//
+		//  RETURNS
+		//
+		//		size_t						-		Index of the first mismatched pixel, the span length if the spans match
+		//
+		//  NOTES
+		//
+		//  The spans are compared as bytes, the pixel type must have no padding and compare equal when every
+		//  channel is equal.
+		//
+
+		static size_t	firstMismatch(const T* pA, const T* pB, size_t Count) {
+			const BYTE*		pBA = (const BYTE*) pA;											//  Span A as bytes
+			const BYTE*		pBB = (const BYTE*) pB;											//  Span B as bytes
+			size_t			Bytes = Count * sizeof(T);										//  Bytes to compare
+			size_t			BX = 0;															//  Byte index
+
+#if (defined(XY_RB_SSE2))
+			//  Skip 16 byte blocks that match
+			while (BX + 16 <= Bytes) {
+				__m128i		VA = _mm_loadu_si128((const __m128i*) (pBA + BX));
+				__m128i		VB = _mm_loadu_si128((const __m128i*) (pBB + BX));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(VA, VB)) != 0xFFFF) break;
+				BX += 16;
+			}
+#endif
+
+			//  Locate the mismatched byte
+			while (BX < Bytes && pBA[BX] == pBB[BX]) BX++;
+
+			//  Return the pixel index
+			return BX / sizeof(T);
+		}
+
+		//  lastMismatch
+		//
+		//  This static function will find the last pixel that differs between two spans of pixels
+		//
+		//  PARAMETERS
+		//
+		//		T*							-		Const pointer to the first span
+		//		T*							-		Const pointer to the second span
+		//		size_t						-		Number of pixels in each span
+		//
+		//  RETURNS
+		//
+		//		size_t						-		Index of the last mismatched pixel plus one, 0 if the spans match
+		//
+		//  NOTES
+		//
+		//  The spans are compared as bytes, see firstMismatch().
+		//
+
+		static size_t	lastMismatch(const T* pA, const T* pB, size_t Count) {
+			const BYTE*		pBA = (const BYTE*) pA;											//  Span A as bytes
+			const BYTE*		pBB = (const BYTE*) pB;											//  Span B as bytes
+			size_t			BX = Count * sizeof(T);											//  Bytes remaining to compare
+
+#if (defined(XY_RB_SSE2))
+			//  Skip 16 byte blocks that match (from the end of the span)
+			while (BX >= 16) {
+				__m128i		VA = _mm_loadu_si128((const __m128i*) (pBA + (BX - 16)));
+				__m128i		VB = _mm_loadu_si128((const __m128i*) (pBB + (BX - 16)));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(VA, VB)) != 0xFFFF) break;
+				BX -= 16;
+			}
+#endif
+
+			//  Locate the mismatched byte
+			while (BX > 0 && pBA[BX - 1] == pBB[BX - 1]) BX--;
+
+			//  Return the pixel index (plus one)
+			return (BX + sizeof(T) - 1) / sizeof(T);
+		}
+
 		//  mapDifference
 		//
 		//  This function will return a RasterBuffer of BYTES that identify the differences between the passed test image and this.
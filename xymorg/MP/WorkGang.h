@@ -0,0 +1,134 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       WorkGang.h																						*
+//*   Suite:      xymorg Integration																				*
+//*   Version:    1.0.0	(Build: 01)																					*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*	This header file contains the definition of the WorkGang class. The class runs a numbered set of independent	*
+//* tasks across a short-lived gang of worker threads and returns when all of the tasks have completed.			*
+//*																													*
+//*	USAGE:																											*
+//*																													*
+//*		WorkGang::run(NumTasks, [&](size_t TaskNo) { ... });														*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.	The gang does not depend on the MP ThreadPool and may be used without XY_NEEDS_MP.							*
+//*	2.	The calling thread is a member of the gang, a single task (or a single core) runs inline.					*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.0.0 -		16/10/2026	-	Initial Release, concurrent decoding of JPEG restart intervals						*
+//*																													*
+//*******************************************************************************************************************/
+
+//  Include xymorg headers
+#include	"../LPBHdrs.h"																			//  Language and Platform base headers
+#include	"../types.h"																			//  xymorg type definitions
+#include	"../consts.h"																			//  xymorg constant definitions
+
+//  Additional Language Headers
+#include    <atomic>
+#include    <thread>
+
+//
+//  All components are defined within the xymorg namespace
+//
+namespace xymorg {
+
+	//
+	//  WorkGang Class Definition - contains ONLY static functions
+	//
+
+	class WorkGang {
+	public:
+
+		//  Prevent Instantiation
+		WorkGang() = delete;
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Public Functions                                                                                              *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  workers
+		//
+		//  Returns the number of workers that a gang will use
+		//
+		//  PARAMETERS
+		//
+		//  RETURNS
+		//
+		//		size_t			-		Number of hardware threads available (at least 1)
+		//
+		//  NOTES
+		//
+
+		static size_t	workers() {
+			size_t		HWT = size_t(std::thread::hardware_concurrency());					//  Hardware threads
+
+			if (HWT == 0) HWT = 1;
+			return HWT;
+		}
+
+		//  run
+		//
+		//  Runs the passed task function once for each task number and waits for all of them to complete
+		//
+		//  PARAMETERS
+		//
+		//		size_t			-		Number of tasks to run (task numbers 0 to n-1)
+		//		T				-		Task function, called as Task(size_t TaskNo)
+		//		size_t			-		Maximum number of workers to use (0 for all available)
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//  Tasks are claimed in ascending order, so a worker that finishes early picks up the next unclaimed task.
+		//
+
+		template <typename T>
+		static void		run(size_t Tasks, T Task, size_t MaxWorkers = 0) {
+			std::atomic<size_t>		NextTask(0);											//  Next task to be claimed
+			size_t					Workers = workers();									//  Workers in the gang
+			std::thread*			Gang = nullptr;											//  Additional worker threads
+
+			if (MaxWorkers > 0 && Workers > MaxWorkers) Workers = MaxWorkers;
+			if (Workers > Tasks) Workers = Tasks;
+
+			//  Worker loop - claim and run tasks until none remain
+			auto	Worker = [&NextTask, &Task, Tasks]() {
+				size_t		TaskNo = NextTask.fetch_add(1);
+				while (TaskNo < Tasks) {
+					Task(TaskNo);
+					TaskNo = NextTask.fetch_add(1);
+				}
+			};
+
+			//  Run inline when there is nothing to share
+			if (Workers <= 1) {
+				Worker();
+				return;
+			}
+
+			//  Start the additional workers, the caller is the last member of the gang
+			Gang = new std::thread[Workers - 1];
+			for (size_t WX = 0; WX < Workers - 1; WX++) Gang[WX] = std::thread(Worker);
+			Worker();
+
+			//  Wait for the gang to finish
+			for (size_t WX = 0; WX < Workers - 1; WX++) Gang[WX].join();
+			delete[] Gang;
+
+			//  Return to caller
+			return;
+		}
+	};
+}
@@ -25,6 +25,8 @@
 //*																													*
 //*	1.0.0 -		02/12/2017	-	Initial Release																		*
 //*	1.1.0 -		27/10/2022	-	MIME type resolver																	*
+//*	1.2.0 -		16/10/2026	-	Memory mapped resource views														*
+//*	1.3.0 -		16/10/2026	-	Streamed resource writers															*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -48,6 +50,12 @@
 #include	"CRYPTO/TripleDESCBC.h"															//  Triple-DES CODEC
 #endif
 
+//  Additional platform headers for memory mapped resources
+#if (!(defined(_WIN32) || defined(_WIN64)))
+#include	<fcntl.h>																		//  File control
+#include	<sys/mman.h>																	//  Memory mapping
+#endif
+
 //
 //  NODE Identifiers for the Virtual Resource Map
 //
@@ -94,6 +102,342 @@ namespace xymorg {
 		STRREF			MappedName;															//  Mapped Name
 	};
 
+	//
+	//  ResourceView class definition
+	//
+	//	A ResourceView is a read-only view of the content of a resource that is returned by VRMapper::mapResource().
+	//	The content is mapped directly from the file where the platform allows, otherwise it is a loaded copy.
+	//	The view is released when the object is destroyed or passed to VRMapper::unmapResource(), views may be
+	//	moved but not copied.
+	//
+
+	class ResourceView {
+	public:
+		ResourceView() : pData(nullptr), Size(0), pBase(nullptr), MapSize(0), Mapped(false) {}
+
+		ResourceView(ResourceView&& Src) : pData(Src.pData), Size(Src.Size), pBase(Src.pBase), MapSize(Src.MapSize), Mapped(Src.Mapped) {
+			Src.detach();
+			return;
+		}
+
+		ResourceView(const ResourceView&) = delete;
+
+		~ResourceView() {
+			release();
+			return;
+		}
+
+		ResourceView& operator = (ResourceView&& Src) {
+			if (this != &Src) {
+				release();
+				pData = Src.pData;
+				Size = Src.Size;
+				pBase = Src.pBase;
+				MapSize = Src.MapSize;
+				Mapped = Src.Mapped;
+				Src.detach();
+			}
+			return *this;
+		}
+
+		ResourceView& operator = (const ResourceView&) = delete;
+
+		const BYTE* getData() const { return pData; }
+		size_t getSize() const { return Size; }
+		bool isValid() const { return pData != nullptr; }
+		bool isMapped() const { return Mapped; }
+
+		//  Release the view
+		void release() {
+			if (pBase != nullptr) {
+				if (Mapped) {
+#if (defined(_WIN32) || defined(_WIN64))
+					UnmapViewOfFile(pBase);
+#else
+					munmap(pBase, MapSize);
+#endif
+				}
+				else free(pBase);
+			}
+			detach();
+			return;
+		}
+
+	private:
+		friend class VRMapper;
+
+		const BYTE*		pData;																//  Resource content
+		size_t			Size;																//  Size of the resource content
+		void*			pBase;																//  Base of the mapping (or loaded copy)
+		size_t			MapSize;															//  Size of the mapping
+		bool			Mapped;																//  Content is mapped from the file
+
+		//  Forget the view without releasing it
+		void detach() {
+			pData = nullptr;
+			Size = 0;
+			pBase = nullptr;
+			MapSize = 0;
+			Mapped = false;
+			return;
+		}
+	};
+
+	//
+	//  ResourceSink class definition
+	//
+	//	A ResourceSink is the interface through which serialisers write the content of a resource incrementally.
+	//	Content is either copied in with write() or produced in place in space obtained from reserve() and then
+	//	committed, nothing else may be written to the sink between a reserve() and the matching commit().
+	//	Once a write has failed the sink is marked as failed and all subsequent writes are rejected.
+	//
+
+	class ResourceSink {
+	public:
+		ResourceSink() : BytesWritten(0), Failed(false) {}
+		virtual ~ResourceSink() {}
+
+		//  Append the passed bytes to the resource, returns false if they could not be written
+		virtual bool write(const BYTE* pData, size_t Len) = 0;
+
+		//  Reserve space for at least the passed number of bytes, returns nullptr (and no space) if the sink has failed
+		virtual BYTE* reserve(size_t MinLen, size_t& Avail) = 0;
+
+		//  Append the passed number of bytes that were produced in the reserved space
+		virtual void commit(size_t Len) = 0;
+
+		size_t getBytesWritten() const { return BytesWritten; }
+		bool hasFailed() const { return Failed; }
+
+		//  Mark the sink as failed, used by a serialiser that cannot complete the content
+		void fail() { Failed = true; return; }
+
+	protected:
+		size_t			BytesWritten;														//  Bytes written to the sink
+		bool			Failed;																//  A write has failed
+	};
+
+	//
+	//  ResourceWriter class definition
+	//
+	//	A ResourceWriter is a ResourceSink that streams the content of a resource to its file through a fixed size
+	//	window, it is returned by VRMapper::openResourceWriter(). The content is complete once close() returns true,
+	//	a writer that is destroyed without being closed is closed implicitly. Writers may be moved but not copied.
+	//
+
+	class ResourceWriter : public ResourceSink {
+	public:
+		static const size_t		DEFAULT_WINDOW = 65536;										//  Default window size (bytes)
+
+		ResourceWriter() : pFile(nullptr), pWindow(nullptr), WindowSize(0), WindowUsed(0) {}
+
+		ResourceWriter(ResourceWriter&& Src) : ResourceSink(Src), pFile(Src.pFile), pWindow(Src.pWindow), WindowSize(Src.WindowSize), WindowUsed(Src.WindowUsed) {
+			Src.detach();
+			return;
+		}
+
+		ResourceWriter(const ResourceWriter&) = delete;
+
+		~ResourceWriter() {
+			close();
+			return;
+		}
+
+		ResourceWriter& operator = (ResourceWriter&& Src) {
+			if (this != &Src) {
+				close();
+				BytesWritten = Src.BytesWritten;
+				Failed = Src.Failed;
+				pFile = Src.pFile;
+				pWindow = Src.pWindow;
+				WindowSize = Src.WindowSize;
+				WindowUsed = Src.WindowUsed;
+				Src.detach();
+			}
+			return *this;
+		}
+
+		ResourceWriter& operator = (const ResourceWriter&) = delete;
+
+		bool isOpen() const { return pFile != nullptr; }
+
+		//  Append the passed bytes to the resource
+		virtual bool write(const BYTE* pData, size_t Len) {
+			if (pFile == nullptr || Failed) return false;
+			if (Len == 0) return true;
+
+			//  Writes larger than the window bypass it
+			if (Len >= WindowSize) {
+				if (!flushWindow()) return false;
+				if (fwrite(pData, 1, Len, pFile) != Len) {
+					Failed = true;
+					return false;
+				}
+			}
+			else {
+				if ((WindowUsed + Len) > WindowSize && !flushWindow()) return false;
+				memcpy(pWindow + WindowUsed, pData, Len);
+				WindowUsed += Len;
+			}
+
+			BytesWritten += Len;
+			return true;
+		}
+
+		//  Reserve space in the window, the window is flushed if it has less than the requested space free
+		virtual BYTE* reserve(size_t MinLen, size_t& Avail) {
+			Avail = 0;
+			if (pFile == nullptr || Failed || MinLen > WindowSize) return nullptr;
+			if ((WindowSize - WindowUsed) < MinLen && !flushWindow()) return nullptr;
+			Avail = WindowSize - WindowUsed;
+			return pWindow + WindowUsed;
+		}
+
+		//  Append the bytes produced in the reserved space of the window
+		virtual void commit(size_t Len) {
+			WindowUsed += Len;
+			BytesWritten += Len;
+			return;
+		}
+
+		//  Flush the window and close the file, returns true if all of the content was written
+		bool close() {
+			if (pFile != nullptr) {
+				flushWindow();
+				if (fclose(pFile) != 0) Failed = true;
+				pFile = nullptr;
+			}
+			if (pWindow != nullptr) free(pWindow);
+			pWindow = nullptr;
+			WindowSize = 0;
+			WindowUsed = 0;
+			return !Failed;
+		}
+
+	private:
+		friend class VRMapper;
+
+		FILE*			pFile;																//  Resource file
+		BYTE*			pWindow;															//  Output window
+		size_t			WindowSize;															//  Size of the output window
+		size_t			WindowUsed;															//  Bytes held in the output window
+
+		//  Write the content of the window to the file
+		bool flushWindow() {
+			if (WindowUsed > 0 && !Failed) {
+				if (fwrite(pWindow, 1, WindowUsed, pFile) != WindowUsed) Failed = true;
+			}
+			WindowUsed = 0;
+			return !Failed;
+		}
+
+		//  Forget the writer without closing it
+		void detach() {
+			BytesWritten = 0;
+			Failed = false;
+			pFile = nullptr;
+			pWindow = nullptr;
+			WindowSize = 0;
+			WindowUsed = 0;
+			return;
+		}
+	};
+
+	//
+	//  ResourceBuffer class definition
+	//
+	//	A ResourceBuffer is a ResourceSink that accumulates the content of a resource in an extensible memory buffer,
+	//	ownership of the buffer is taken with acquireBuffer().
+	//
+
+	class ResourceBuffer : public ResourceSink {
+	public:
+		ResourceBuffer() : pBuffer(nullptr), BufferSize(0) {}
+
+		explicit ResourceBuffer(size_t InitialSize) : pBuffer(nullptr), BufferSize(0) {
+			pBuffer = (BYTE*) malloc(InitialSize);
+			if (pBuffer != nullptr) BufferSize = InitialSize;
+			return;
+		}
+
+		ResourceBuffer(const ResourceBuffer&) = delete;
+
+		~ResourceBuffer() {
+			if (pBuffer != nullptr) free(pBuffer);
+			return;
+		}
+
+		ResourceBuffer& operator = (const ResourceBuffer&) = delete;
+
+		//  Append the passed bytes to the buffer, extending it as needed
+		virtual bool write(const BYTE* pData, size_t Len) {
+			if (Len == 0) return !Failed;
+			if (!extend(Len)) return false;
+
+			memcpy(pBuffer + BytesWritten, pData, Len);
+			BytesWritten += Len;
+			return true;
+		}
+
+		//  Content of the buffer, valid until the buffer is next extended or acquired
+		const BYTE* getData() const { return pBuffer; }
+
+		//  Reserve space at the end of the buffer, extending it as needed
+		virtual BYTE* reserve(size_t MinLen, size_t& Avail) {
+			Avail = 0;
+			if (!extend(MinLen)) return nullptr;
+			Avail = BufferSize - BytesWritten;
+			return pBuffer + BytesWritten;
+		}
+
+		//  Append the bytes produced in the reserved space of the buffer
+		virtual void commit(size_t Len) {
+			BytesWritten += Len;
+			return;
+		}
+
+		//  Take ownership of the (trimmed) buffer, nullptr is returned if the buffer is empty or a write failed
+		BYTE* acquireBuffer(size_t& Size) {
+			BYTE*		pContent = pBuffer;															//  Content of the buffer
+
+			Size = 0;
+			if (Failed || BytesWritten == 0) return nullptr;
+
+			if ((BufferSize - BytesWritten) > 256) {
+				BYTE*		pTrimmed = (BYTE*) realloc(pBuffer, BytesWritten);
+				if (pTrimmed != nullptr) pContent = pTrimmed;
+			}
+
+			Size = BytesWritten;
+			pBuffer = nullptr;
+			BufferSize = 0;
+			BytesWritten = 0;
+			return pContent;
+		}
+
+	private:
+		BYTE*			pBuffer;															//  Content buffer
+		size_t			BufferSize;															//  Allocated size of the buffer
+
+		//  Ensure that the buffer has room for the passed number of bytes, the buffer (at least) doubles when extended
+		bool extend(size_t Len) {
+			if (Failed) return false;
+			if ((BytesWritten + Len) <= BufferSize) return true;
+
+			size_t		NewSize = (BufferSize < 4096) ? 4096 : BufferSize * 2;				//  New buffer size
+			if (NewSize < (BytesWritten + Len)) NewSize = BytesWritten + Len;
+
+			BYTE*		pNewBuffer = (BYTE*) realloc(pBuffer, NewSize);						//  Extended buffer
+			if (pNewBuffer == nullptr) {
+				Failed = true;
+				return false;
+			}
+			pBuffer = pNewBuffer;
+			BufferSize = NewSize;
+			return true;
+		}
+	};
+
 	//
 	//  VRMapper class definition
 	//
@@ -626,6 +970,99 @@ namespace xymorg {
 			return pFImg;
 		}
 
+		//  mapResource
+		//
+		//  Maps the resource identified by the passed virtual file name into memory as a read-only view.
+		//
+		//  PARAMETERS:
+		//
+		//		const char*		-		Const pointer to the virtual file name of the resource
+		//
+		//  RETURNS:
+		//
+		//		ResourceView	-		View of the resource content, the view is not valid if the resource could not be mapped
+		//
+		//  NOTES:
+		//
+		//	1.		The view MUST NOT be written to.
+		//	2.		If the file cannot be mapped (e.g. it is empty) then the view holds a loaded copy of the resource.
+		//  
+
+		ResourceView mapResource(const char* szVRN) {
+			ResourceView	View;																								//  Resource view
+			char			szFileName[MAX_PATH + 1];																			//  Mapped file name
+
+			//  Safety
+			if (szVRN == nullptr) return View;
+			if (szVRN[0] == '\0') return View;
+
+			//  Map the virtual file name to the real name
+			mapFile(szVRN, szFileName, MAX_PATH + 1);
+			if (szFileName[0] == '\0') return View;
+
+#if (defined(_WIN32) || defined(_WIN64))
+			HANDLE			hFile = CreateFileA(szFileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+			if (hFile != INVALID_HANDLE_VALUE) {
+				LARGE_INTEGER	FSize = {};																						//  File size
+
+				if (GetFileSizeEx(hFile, &FSize) && FSize.QuadPart > 0) {
+					HANDLE		hMap = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+					if (hMap != NULL) {
+						View.pBase = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+						if (View.pBase != NULL) View.MapSize = size_t(FSize.QuadPart);
+						CloseHandle(hMap);
+					}
+				}
+				CloseHandle(hFile);
+			}
+#else
+			int				FD = open(szFileName, O_RDONLY);																	//  File descriptor
+			if (FD >= 0) {
+				struct stat		FStat = {};																						//  File status
+
+				if (fstat(FD, &FStat) == 0 && S_ISREG(FStat.st_mode) && FStat.st_size > 0) {
+					void*		pBase = mmap(nullptr, size_t(FStat.st_size), PROT_READ, MAP_PRIVATE, FD, 0);
+					if (pBase != MAP_FAILED) {
+						View.pBase = pBase;
+						View.MapSize = size_t(FStat.st_size);
+					}
+				}
+				close(FD);
+			}
+#endif
+
+			//  Return the mapped view
+			if (View.pBase != nullptr) {
+				View.pData = (const BYTE*) View.pBase;
+				View.Size = View.MapSize;
+				View.Mapped = true;
+				return View;
+			}
+
+			//  The file could not be mapped, load a copy of the resource instead
+			View.pBase = loadResource(szVRN, View.Size);
+			View.pData = (const BYTE*) View.pBase;
+			return View;
+		}
+
+		//  unmapResource
+		//
+		//  Releases a view of a resource that was returned by mapResource().
+		//
+		//  PARAMETERS:
+		//
+		//		ResourceView&	-		Reference to the view to be released
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		void unmapResource(ResourceView& View) {
+			View.release();
+			return;
+		}
+
 		//  loadCharmedResource
 		//
 		//  Loads the charmed resource identified by the passed virtual file name. Returns a pointer to the loaded uncharmed file and the length of the loaded file.
@@ -933,6 +1370,55 @@ namespace xymorg {
 			return true;
 		}
 
+		//  openResourceWriter
+		//
+		//  Opens the specified (virtual) file for streamed output of a resource
+		//
+		//  PARAMETERS:
+		//
+		//		const char*		-		Const pointer to the virtual file name of the resource
+		//
+		//  RETURNS:
+		//
+		//		ResourceWriter	-		Writer for the resource, the writer is not open if the file could not be created
+		//
+		//  NOTES:
+		//
+		//	1.		The content of the resource is written through a window of ResourceWriter::DEFAULT_WINDOW bytes so
+		//			the whole resource never needs to be held in memory.
+		//	2.		The resource is only complete when ResourceWriter::close() returns true.
+		//  
+
+		ResourceWriter openResourceWriter(const char* szVRN) {
+			ResourceWriter	Writer;																								//  Resource writer
+			FILE*			pRFile = nullptr;																					//  Handle of the resource file
+			char			szFileName[MAX_PATH + 1];																			//  Mapped file name
+
+			//  Safety
+			if (szVRN == nullptr) return Writer;
+			if (szVRN[0] == '\0') return Writer;
+
+			//  Map the virtual file name to the real name
+			mapFile(szVRN, szFileName, MAX_PATH + 1);
+			if (szFileName[0] == '\0') return Writer;
+
+			//  Allocate the output window
+			Writer.pWindow = (BYTE*) malloc(ResourceWriter::DEFAULT_WINDOW);
+			if (Writer.pWindow == nullptr) return Writer;
+			Writer.WindowSize = ResourceWriter::DEFAULT_WINDOW;
+
+			//  Open the requested file for output, the window replaces the stream buffering
+			if (fopen_s(&pRFile, szFileName, "wb") != 0 || pRFile == nullptr) {
+				Writer.close();
+				return Writer;
+			}
+			setvbuf(pRFile, nullptr, _IONBF, 0);
+			Writer.pFile = pRFile;
+
+			//  Return the open writer
+			return Writer;
+		}
+
 		//  storeCharmedResource
 		//
 		//  Charms and stores the passed resource in the specified (virtual) file